@@ -54,11 +54,9 @@ PAGE 1 : /* Data Memory */
    RAMGS3      : origin = 0x00F000, length = 0x001000
    RAMGS4      : origin = 0x010000, length = 0x001000
    RAMGS5      : origin = 0x011000, length = 0x001000
-   RAMGS6      : origin = 0x012000, length = 0x001000
-   RAMGS7      : origin = 0x013000, length = 0x001000
+   RAMGS6_7    : origin = 0x012000, length = 0x002000     /* RAMGS6 + RAMGS7, one 12-bit histogram (adc_histogram.c) */
    RAMGS8      : origin = 0x014000, length = 0x001000
-   RAMGS9      : origin = 0x015000, length = 0x001000
-   RAMGS10     : origin = 0x016000, length = 0x001000
+   RAMGS9_10   : origin = 0x015000, length = 0x002000     /* RAMGS9 + RAMGS10, 4096-point FFT record (adc_spectrum.c) */
 
 //   RAMGS11     : origin = 0x017000, length = 0x000FF8   /* Uncomment for F28374D, F28376D devices */
 
@@ -68,6 +66,9 @@ PAGE 1 : /* Data Memory */
    RAMGS12     : origin = 0x018000, length = 0x001000     /* Only Available on F28379D, F28377D, F28375D devices. Remove line on other devices. */
    RAMGS13     : origin = 0x019000, length = 0x001000     /* Only Available on F28379D, F28377D, F28375D devices. Remove line on other devices. */
 
+   CLA1_MSGRAMLOW  : origin = 0x001480, length = 0x000080
+   CLA1_MSGRAMHIGH : origin = 0x001500, length = 0x000080
+
    CPU2TOCPU1RAM   : origin = 0x03F800, length = 0x000400
    CPU1TOCPU2RAM   : origin = 0x03FC00, length = 0x000400
 }
@@ -85,7 +86,7 @@ SECTIONS
 
 #if defined(__TI_EABI__)
    .init_array         : > FLASHB,       PAGE = 0,       ALIGN(8)
-   .bss                : > RAMLS5,       PAGE = 1
+   .bss                : >> RAMLS5 | RAMGS3,    PAGE = 1
    .bss:output         : > RAMLS3,       PAGE = 0
    .bss:cio            : > RAMLS5,       PAGE = 1
    .data               : > RAMLS5,       PAGE = 1
@@ -109,6 +110,28 @@ SECTIONS
    ramgs0           : > RAMGS0,     PAGE = 1
    ramgs1           : > RAMGS1,     PAGE = 1
 
+   /* ADC DMA ping-pong capture blocks (adc_dma.c) */
+   adcdmabuf        : > RAMGS2,     PAGE = 1
+
+   /* CLA program and data (adc_cla.c, adc_cla_tasks.cla); RAMLS4/RAMLS2 are
+      handed to CLA1 at run time, see ADC_CLA_PROG_RAM/ADC_CLA_DATA_RAM */
+   Cla1Prog         : LOAD = FLASHD,
+                      RUN = RAMLS4,
+                      LOAD_START(Cla1ProgLoadStart),
+                      LOAD_SIZE(Cla1ProgLoadSize),
+                      RUN_START(Cla1ProgRunStart),
+                      PAGE = 0, ALIGN(8)
+   .scratchpad      : > RAMLS2,     PAGE = 0
+   .bss_cla         : > RAMLS2,     PAGE = 0
+   .const_cla       : LOAD = FLASHB,
+                      RUN = RAMLS2,
+                      LOAD_START(Cla1ConstLoadStart),
+                      LOAD_SIZE(Cla1ConstLoadSize),
+                      RUN_START(Cla1ConstRunStart),
+                      PAGE = 0, ALIGN(8)
+   Cla1ToCpuMsgRAM  : > CLA1_MSGRAMLOW,  PAGE = 1
+   CpuToCla1MsgRAM  : > CLA1_MSGRAMHIGH, PAGE = 1
+
 #ifdef __TI_COMPILER_VERSION__
     #if __TI_COMPILER_VERSION__ >= 15009000
         #if defined(__TI_EABI__)
@@ -146,6 +169,36 @@ SECTIONS
 
 #endif
 
+   /* Per-board ADC calibration table (adc_calibration.c); NOLOAD keeps the
+      application image from programming or erasing it */
+   adccal           : > FLASHN,     PAGE = 0, TYPE = NOLOAD
+
+   /* Sliding-window storage pools (adc_window.c) */
+   adcwindow0       : > RAMGS4,     PAGE = 1
+   adcwindow1       : > RAMGS5,     PAGE = 1
+
+   /* Code-density histogram bin pools (adc_histogram.c) */
+   adchist0         : > RAMGS6_7,   PAGE = 1
+   adchist1         : > RAMGS8,     PAGE = 1
+
+   /* FFT record, window and twiddle tables (adc_spectrum.c) */
+   adcfftbuf        : > RAMGS9_10,  PAGE = 1
+   adcfftwin        : > RAMGS11,    PAGE = 1
+   adcfftsin        : > RAMGS12,    PAGE = 1
+
+   /* FIR coefficient and delay-line pools (adc_fir.c) */
+   adcfircoef       : > RAMD1,      PAGE = 1
+   adcfirdelay      : > RAMGS13,    PAGE = 1
+
+   /* Moving-average code rings (adc_smooth.c) */
+   adcsmooth        : > RAMGS14,    PAGE = 0
+
+   /* UART transmit queue (uart_tx.c) */
+   uarttxbuf        : > RAMGS15,    PAGE = 0
+
+   /* Dual-core block configuration read by CPU2 (adc_dualcore.c) */
+   adcIpcConfig     : > CPU1TOCPU2RAM, PAGE = 1
+
    /* The following section definitions are required when using the IPC API Drivers */
     GROUP : > CPU1TOCPU2RAM, PAGE = 1
     {
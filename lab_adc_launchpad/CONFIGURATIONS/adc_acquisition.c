@@ -0,0 +1,249 @@
+/**
+ * @file adc_acquisition.c
+ * @brief Hardware-paced (ePWM-triggered) ADC acquisition with ring buffer.
+ *
+ * This file replaces the software-forced, busy-polled conversion of
+ * AdcConversion() with a deterministic sample clock. ePWM1 SOCA starts the SOC
+ * of every channel in adcChannels[] at the same instant, and the ADCA
+ * interrupt 1 ISR reads all results and pushes them into a ring buffer
+ * consumed by the main loop.
+ *
+ * @date Created on: Feb 02, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_acquisition.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Largest ePWM timebase period in counts (TBPRD is 16-bit, up-count).
+ */
+#define ADC_ACQ_MAX_PERIOD_COUNTS   65536UL
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Ring buffer in GS RAM, written by the ISR and read by the main loop
+#pragma DATA_SECTION(adcAcqBuffer, "ramgs0")
+static AdcSample adcAcqBuffer[ADC_ACQ_BUFFER_SIZE];
+
+static volatile uint16_t acqHead = 0;       // Next slot written by the ISR
+static volatile uint16_t acqTail = 0;       // Next slot read by the main loop
+static volatile uint32_t acqOverruns = 0;   // Samples lost to a full buffer
+static volatile bool acqDropping = false;   // Set by the ISR on a loss, cleared when empty
+static uint32_t acqGaps = 0;                // Gaps reached by the main loop
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Configures ePWM-paced acquisition at the requested sample rate.
+ *
+ * The timebase runs in up-count mode and raises SOCA on every counter zero,
+ * so the sample period is (TBPRD + 1) TBCLK cycles. The TBCLK prescaler is
+ * increased only when the period does not fit in 16 bits (rates below
+ * about 1.5 kHz), which keeps the best rate resolution.
+ *
+ * Note: every channel SOC keeps the input selected in SysConfig; only the
+ * trigger source changes from ADC_TRIGGER_SW_ONLY to ePWM1 SOCA.
+ *
+ * @param sampleRateHz Requested sample rate in Hz (1 to ADC_ACQ_MAX_RATE_HZ).
+ * @return Actual sample rate in Hz after timebase quantization.
+ */
+uint32_t AdcAcquisitionInit(uint32_t sampleRateHz)
+{
+    uint32_t tbClk = ADC_ACQ_EPWMCLK_FREQ;
+    uint32_t periodCounts;
+    uint16_t clkDiv = 0;
+    uint16_t ch;
+
+    if (sampleRateHz == 0U)
+        sampleRateHz = 1U;
+    if (sampleRateHz > ADC_ACQ_MAX_RATE_HZ)
+        sampleRateHz = ADC_ACQ_MAX_RATE_HZ;
+
+    // Pick the smallest TBCLK prescaler that fits the period in 16 bits
+    periodCounts = tbClk / sampleRateHz;
+    while ((periodCounts > ADC_ACQ_MAX_PERIOD_COUNTS) && (clkDiv < 7U))
+    {
+        clkDiv++;
+        tbClk >>= 1;
+        periodCounts = tbClk / sampleRateHz;
+    }
+    if (periodCounts > ADC_ACQ_MAX_PERIOD_COUNTS)
+        periodCounts = ADC_ACQ_MAX_PERIOD_COUNTS;
+
+    //
+    // ePWM timebase: stopped until AdcAcquisitionStart()
+    //
+    SysCtl_disablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+
+    EPWM_setTimeBaseCounterMode(ADC_ACQ_EPWM_BASE, EPWM_COUNTER_MODE_STOP_FREEZE);
+    EPWM_setClockPrescaler(ADC_ACQ_EPWM_BASE, (EPWM_ClockDivider)clkDiv,
+                           EPWM_HSCLOCK_DIVIDER_1);
+    EPWM_setTimeBasePeriod(ADC_ACQ_EPWM_BASE, (uint16_t)(periodCounts - 1U));
+    EPWM_setTimeBaseCounter(ADC_ACQ_EPWM_BASE, 0U);
+    EPWM_disablePhaseShiftLoad(ADC_ACQ_EPWM_BASE);
+    EPWM_setEmulationMode(ADC_ACQ_EPWM_BASE, EPWM_EMULATION_FREE_RUN);
+
+    // SOCA on every counter zero
+    EPWM_disableADCTrigger(ADC_ACQ_EPWM_BASE, EPWM_SOC_A);
+    EPWM_setADCTriggerSource(ADC_ACQ_EPWM_BASE, EPWM_SOC_A, EPWM_SOC_TBCTR_ZERO);
+    EPWM_setADCTriggerEventPrescale(ADC_ACQ_EPWM_BASE, EPWM_SOC_A, 1U);
+
+    SysCtl_enablePeripheral(SYSCTL_PERIPH_CLK_TBCLKSYNC);
+
+    //
+    // ADC: route the SOC of every channel to the ePWM SOCA pulse
+    //
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        ADC_setupSOC(adcChannels[ch].base, adcChannels[ch].soc, ADC_ACQ_EPWM_TRIGGER,
+                     adcChannels[ch].channel, ADC_SAMPLE_WINDOW);
+        ADC_clearInterruptStatus(adcChannels[ch].base, ADC_INT_NUMBER1);
+    }
+
+    //
+    // Interrupt: ADCA1 (channel 0) signals that the sample is ready
+    //
+    Interrupt_register(INT_ADCA1, &AdcAcquisitionISR);
+    Interrupt_enable(INT_ADCA1);
+
+    acqHead = 0;
+    acqTail = 0;
+    acqOverruns = 0;
+    acqDropping = false;
+    acqGaps = 0;
+
+    return tbClk / periodCounts;
+}
+
+/**
+ * @brief Starts the ePWM timebase, so SOCs are triggered at the sample rate.
+ */
+void AdcAcquisitionStart(void)
+{
+    EPWM_setTimeBaseCounter(ADC_ACQ_EPWM_BASE, 0U);
+    EPWM_enableADCTrigger(ADC_ACQ_EPWM_BASE, EPWM_SOC_A);
+    EPWM_setTimeBaseCounterMode(ADC_ACQ_EPWM_BASE, EPWM_COUNTER_MODE_UP);
+}
+
+/**
+ * @brief Freezes the ePWM timebase and stops triggering SOCs.
+ */
+void AdcAcquisitionStop(void)
+{
+    EPWM_disableADCTrigger(ADC_ACQ_EPWM_BASE, EPWM_SOC_A);
+    EPWM_setTimeBaseCounterMode(ADC_ACQ_EPWM_BASE, EPWM_COUNTER_MODE_STOP_FREEZE);
+}
+
+/**
+ * @brief Pops the oldest sample from the ring buffer.
+ *
+ * Single producer (ISR) / single consumer (main loop): the ISR only writes
+ * acqHead and the main loop only writes acqTail, so no locking is needed.
+ * acqDropping is cleared here only with the buffer empty; the ISR queues
+ * nothing while it is set, so no sample from before a gap is still unread.
+ *
+ * @param read Array to store the raw ADC results (minimum size: NUM_ADC_CHANNELS).
+ * @return true if a sample was returned, false if the buffer was empty.
+ */
+bool AdcAcquisitionRead(uint16_t read[])
+{
+    uint16_t i;
+    uint16_t tail = acqTail;
+
+    if (tail == acqHead)
+    {
+        // Everything before the gap has been read: the ISR may queue again
+        if (acqDropping)
+        {
+            acqDropping = false;
+            acqGaps++;
+        }
+        return false;
+    }
+
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+        read[i] = adcAcqBuffer[tail].raw[i];
+
+    acqTail = (tail + 1U) & ADC_ACQ_BUFFER_MASK;
+    return true;
+}
+
+/**
+ * @brief Returns the number of samples waiting in the ring buffer.
+ */
+uint16_t AdcAcquisitionAvailable(void)
+{
+    return (acqHead - acqTail) & ADC_ACQ_BUFFER_MASK;
+}
+
+/**
+ * @brief Returns the number of samples dropped because the buffer was full.
+ */
+uint32_t AdcAcquisitionGetOverruns(void)
+{
+    return acqOverruns;
+}
+
+/**
+ * @brief Returns the number of gaps in the sample stream reached by the reader.
+ */
+uint32_t AdcAcquisitionGetGaps(void)
+{
+    return acqGaps;
+}
+
+/**
+ * @brief ADCA interrupt 1 ISR: reads all channels and queues the sample.
+ *
+ * All converters are started by the same SOCA pulse. The 12-bit conversions
+ * are shorter than the 16-bit ADCA one, so their results are already latched
+ * when ADCA raises ADCINT1.
+ *
+ * On a lost sample (full buffer or a missed interrupt) the ISR stops queuing
+ * until AdcAcquisitionRead() finds the buffer empty, so every loss ends the
+ * queued stream at one point and AdcAcquisitionGetGaps() counts it there.
+ */
+__interrupt void AdcAcquisitionISR(void)
+{
+    uint16_t head = acqHead;
+    uint16_t next = (head + 1U) & ADC_ACQ_BUFFER_MASK;
+    uint16_t ch;
+
+    // A trigger arrived before the previous flag was cleared: the sample
+    // before this one was lost
+    if (ADC_getInterruptOverflowStatus(adcChannels[0].base, ADC_INT_NUMBER1))
+    {
+        ADC_clearInterruptOverflowStatus(adcChannels[0].base, ADC_INT_NUMBER1);
+        acqOverruns++;
+        acqDropping = true;
+    }
+
+    if (!acqDropping && (next != acqTail))
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        {
+            adcAcqBuffer[head].raw[ch] = ADC_readResult(adcChannels[ch].resultBase,
+                                                        adcChannels[ch].soc);
+        }
+        acqHead = next;
+    }
+    else
+    {
+        acqOverruns++;
+        acqDropping = true;
+    }
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        ADC_clearInterruptStatus(adcChannels[ch].base, ADC_INT_NUMBER1);
+
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+}
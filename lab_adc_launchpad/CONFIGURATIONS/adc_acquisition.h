@@ -0,0 +1,141 @@
+/**
+ * @file adc_acquisition.h
+ * @brief Header file for hardware-paced (ePWM-triggered) ADC acquisition.
+ *
+ * This file contains definitions and function declarations for the
+ * interrupt-driven acquisition mode. An ePWM timebase generates SOCA pulses
+ * that start the SOCs configured by SysConfig (myADCA_init/myADCB_init), and
+ * the ADCA interrupt 1 ISR pushes each completed sample into a ring buffer.
+ *
+ * @date Created on: Feb 02, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_ACQUISITION_H_
+#define ADC_ACQUISITION_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"          // Include SysConfig generated header
+#include "adc_config.h"     // NUM_ADC_CHANNELS
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief ePWM module used as the ADC sample clock.
+ */
+#define ADC_ACQ_EPWM_BASE           EPWM1_BASE
+
+/**
+ * @brief ADC trigger source matching ADC_ACQ_EPWM_BASE.
+ */
+#define ADC_ACQ_EPWM_TRIGGER        ADC_TRIGGER_EPWM1_SOCA
+
+/**
+ * @brief ePWM timebase input clock in Hz.
+ *
+ * EPWMCLK is PLLSYSCLK / 2 (SYSCTL_EPWMCLK_DIV_2 in device.c) = 100 MHz.
+ */
+#define ADC_ACQ_EPWMCLK_FREQ        (DEVICE_SYSCLK_FREQ / 2U)
+
+/**
+ * @brief Highest sample rate accepted by AdcAcquisitionInit().
+ *
+ * Limited by the 16-bit differential conversion on ADCA with the 200 SYSCLK
+ * sample window configured in SysConfig (about 1.3 us per conversion).
+ */
+#define ADC_ACQ_MAX_RATE_HZ         500000UL
+
+/**
+ * @brief Number of samples held by the ring buffer (must be a power of two).
+ *
+ * The buffer lives in GS RAM (section ramgs0), so one sample is
+ * NUM_ADC_CHANNELS words and the whole buffer must fit in 4K words.
+ * After a lost sample the ISR queues nothing until the main loop has emptied
+ * the buffer, so the samples lost form one gap the reader can see.
+ */
+#define ADC_ACQ_BUFFER_SIZE         1024U
+#define ADC_ACQ_BUFFER_MASK         (ADC_ACQ_BUFFER_SIZE - 1U)
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief One acquisition sample: raw results of all channels from one trigger.
+ *
+ * Channel order matches adcChannels[] (ADC_CHANNEL_TABLE in adc_config.h).
+ */
+typedef struct
+{
+    uint16_t raw[NUM_ADC_CHANNELS];
+} AdcSample;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Configures ePWM-paced acquisition at the requested sample rate.
+ *
+ * Sets up the ePWM timebase, re-routes the SOC trigger of every channel to
+ * the ePWM SOCA pulse and registers the ADCA interrupt 1 ISR. Acquisition stays
+ * stopped until AdcAcquisitionStart() is called. Must be called after
+ * Board_init() and Interrupt_initVectorTable().
+ *
+ * @param sampleRateHz Requested sample rate in Hz (1 to ADC_ACQ_MAX_RATE_HZ).
+ * @return Actual sample rate in Hz after timebase quantization.
+ */
+uint32_t AdcAcquisitionInit(uint32_t sampleRateHz);
+
+/**
+ * @brief Starts the ePWM timebase, so SOCs are triggered at the sample rate.
+ */
+void AdcAcquisitionStart(void);
+
+/**
+ * @brief Freezes the ePWM timebase and stops triggering SOCs.
+ */
+void AdcAcquisitionStop(void);
+
+/**
+ * @brief Pops the oldest sample from the ring buffer.
+ *
+ * A false return also marks the end of the samples queued before a gap:
+ * AdcAcquisitionGetGaps() then tells whether the next sample follows one.
+ *
+ * @param read Array to store the raw ADC results (minimum size: NUM_ADC_CHANNELS).
+ * @return true if a sample was returned, false if the buffer was empty.
+ */
+bool AdcAcquisitionRead(uint16_t read[]);
+
+/**
+ * @brief Returns the number of samples waiting in the ring buffer.
+ */
+uint16_t AdcAcquisitionAvailable(void);
+
+/**
+ * @brief Returns the number of samples dropped because the buffer was full.
+ */
+uint32_t AdcAcquisitionGetOverruns(void);
+
+/**
+ * @brief Returns the number of gaps in the sample stream reached by the reader.
+ *
+ * Counts up when AdcAcquisitionRead() has returned every sample queued before
+ * a run of lost samples; stream filters should restart before the next sample.
+ */
+uint32_t AdcAcquisitionGetGaps(void);
+
+/**
+ * @brief ADCA interrupt 1 ISR: reads all channels and queues the sample.
+ */
+__interrupt void AdcAcquisitionISR(void);
+
+#endif /* ADC_ACQUISITION_H_ */
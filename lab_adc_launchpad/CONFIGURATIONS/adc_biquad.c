@@ -0,0 +1,243 @@
+/**
+ * @file adc_biquad.c
+ * @brief Cascaded biquad IIR filters in transposed direct form II.
+ *
+ * This file contains the block and design functions for biquad cascades in
+ * transposed direct form II.
+ *
+ * @date Created on: Jun 22, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_biquad.h"
+#include <math.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+#define ADC_BIQUAD_PI           3.14159265358979f
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Runs one section over a block in place.
+ */
+static void AdcBiquadSection(const AdcBiquadCoeffs *c, float w[2], float *x, size_t n)
+{
+    float b0 = c->b0;
+    float b1 = c->b1;
+    float b2 = c->b2;
+    float a1 = c->a1;
+    float a2 = c->a2;
+    float w0 = w[0];
+    float w1 = w[1];
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        float in = x[i];
+        float y = b0 * in + w0;
+
+        w0 = b1 * in - a1 * y + w1;
+        w1 = b2 * in - a2 * y;
+        x[i] = y;
+    }
+
+    w[0] = w0;
+    w[1] = w1;
+}
+
+/**
+ * @brief Runs every section over a block already copied to out.
+ */
+static void AdcBiquadCascadeBlock(AdcBiquadCascade *cascade, float *out, size_t n)
+{
+    uint16_t s;
+
+    for (s = 0; s < cascade->numSections; s++)
+        AdcBiquadSection(&cascade->coeff[s], cascade->w[s], out, n);
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Designs a notch (RBJ cookbook), unity gain away from f0.
+ *
+ * @param c Receives the section.
+ * @param f0Hz Notch frequency.
+ * @param fsHz Sample rate.
+ * @param q Quality factor (f0 / -3 dB bandwidth).
+ */
+void AdcBiquadDesignNotch(AdcBiquadCoeffs *c, float f0Hz, float fsHz, float q)
+{
+    float w0 = 2.0f * ADC_BIQUAD_PI * f0Hz / fsHz;
+    float cosW = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    float a0 = 1.0f + alpha;
+
+    c->b0 = 1.0f / a0;
+    c->b1 = -2.0f * cosW / a0;
+    c->b2 = 1.0f / a0;
+    c->a1 = -2.0f * cosW / a0;
+    c->a2 = (1.0f - alpha) / a0;
+}
+
+/**
+ * @brief Designs a second-order low-pass (RBJ cookbook), unity DC gain.
+ *
+ * @param c Receives the section.
+ * @param fcHz Cut-off frequency.
+ * @param fsHz Sample rate.
+ * @param q Quality factor (0.7071 for a single Butterworth section).
+ */
+void AdcBiquadDesignLowpass(AdcBiquadCoeffs *c, float fcHz, float fsHz, float q)
+{
+    float w0 = 2.0f * ADC_BIQUAD_PI * fcHz / fsHz;
+    float cosW = cosf(w0);
+    float alpha = sinf(w0) / (2.0f * q);
+    float a0 = 1.0f + alpha;
+
+    c->b0 = 0.5f * (1.0f - cosW) / a0;
+    c->b1 = (1.0f - cosW) / a0;
+    c->b2 = 0.5f * (1.0f - cosW) / a0;
+    c->a1 = -2.0f * cosW / a0;
+    c->a2 = (1.0f - alpha) / a0;
+}
+
+/**
+ * @brief Selects a coefficient set and clears the state.
+ *
+ * @param cascade Cascade to set up.
+ * @param coeff Coefficient set (kept by reference, numSections entries).
+ * @param numSections 1 to ADC_BIQUAD_MAX_SECTIONS.
+ * @return false if numSections is out of range.
+ */
+bool AdcBiquadInit(AdcBiquadCascade *cascade, const AdcBiquadCoeffs *coeff,
+                   uint16_t numSections)
+{
+    if ((coeff == NULL) || (numSections == 0U) || (numSections > ADC_BIQUAD_MAX_SECTIONS))
+        return false;
+
+    cascade->coeff = coeff;
+    cascade->numSections = numSections;
+    AdcBiquadReset(cascade);
+
+    return true;
+}
+
+/**
+ * @brief Switches to another coefficient set without clearing the state.
+ *
+ * @param cascade Cascade to switch.
+ * @param coeff New coefficient set.
+ * @param numSections 1 to ADC_BIQUAD_MAX_SECTIONS.
+ * @return false if numSections is out of range (set not changed).
+ */
+bool AdcBiquadSelect(AdcBiquadCascade *cascade, const AdcBiquadCoeffs *coeff,
+                     uint16_t numSections)
+{
+    uint16_t s;
+
+    if ((coeff == NULL) || (numSections == 0U) || (numSections > ADC_BIQUAD_MAX_SECTIONS))
+        return false;
+
+    for (s = cascade->numSections; s < numSections; s++)
+    {
+        cascade->w[s][0] = 0.0f;
+        cascade->w[s][1] = 0.0f;
+    }
+
+    cascade->coeff = coeff;
+    cascade->numSections = numSections;
+
+    return true;
+}
+
+/**
+ * @brief Clears the state of every section.
+ *
+ * @param cascade Cascade to clear.
+ */
+void AdcBiquadReset(AdcBiquadCascade *cascade)
+{
+    uint16_t s;
+
+    for (s = 0; s < ADC_BIQUAD_MAX_SECTIONS; s++)
+    {
+        cascade->w[s][0] = 0.0f;
+        cascade->w[s][1] = 0.0f;
+    }
+}
+
+/**
+ * @brief Sets the state as if the input had been x forever (no start-up step).
+ *
+ * In steady state each section outputs y = G x with G its DC gain, and the
+ * state equations give w1 = b2 x - a2 y, w0 = b1 x - a1 y + w1.
+ *
+ * @param cascade Cascade to prime.
+ * @param x Constant input.
+ */
+void AdcBiquadPrime(AdcBiquadCascade *cascade, float x)
+{
+    uint16_t s;
+
+    for (s = 0; s < cascade->numSections; s++)
+    {
+        const AdcBiquadCoeffs *c = &cascade->coeff[s];
+        float den = 1.0f + c->a1 + c->a2;
+        float y = (den != 0.0f) ? (x * (c->b0 + c->b1 + c->b2) / den) : 0.0f;
+
+        cascade->w[s][1] = c->b2 * x - c->a2 * y;
+        cascade->w[s][0] = c->b1 * x - c->a1 * y + cascade->w[s][1];
+        x = y;
+    }
+}
+
+/**
+ * @brief Filters a block of floats (in and out may be the same array).
+ *
+ * @param cascade Cascade to run.
+ * @param in Input samples.
+ * @param out Receives n outputs.
+ * @param n Number of samples.
+ */
+void AdcBiquadProcessBlock(AdcBiquadCascade *cascade, const float *in, float *out, size_t n)
+{
+    size_t i;
+
+    if (in != out)
+    {
+        for (i = 0; i < n; i++)
+            out[i] = in[i];
+    }
+
+    AdcBiquadCascadeBlock(cascade, out, n);
+}
+
+/**
+ * @brief Filters a block of raw codes of one channel (output in codes).
+ *
+ * @param cascade Cascade to run.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives n outputs.
+ */
+void AdcBiquadProcessCodes(AdcBiquadCascade *cascade, const uint16_t *in, size_t n,
+                           size_t stride, float *out)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        out[i] = (float)in[i * stride];
+
+    AdcBiquadCascadeBlock(cascade, out, n);
+}
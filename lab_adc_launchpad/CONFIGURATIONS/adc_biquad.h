@@ -0,0 +1,175 @@
+/**
+ * @file adc_biquad.h
+ * @brief Header file for cascaded biquad IIR filters (transposed direct form II).
+ *
+ * This file contains definitions and function declarations for cascaded
+ * second-order IIR sections with swappable coefficient sets.
+ *
+ * @date Created on: Jun 22, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_BIQUAD_H_
+#define ADC_BIQUAD_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Largest number of sections per cascade.
+ */
+#define ADC_BIQUAD_MAX_SECTIONS     6U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Coefficients of one section, normalized to a0 = 1.
+ *
+ * H(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ */
+typedef struct
+{
+    float b0;
+    float b1;
+    float b2;
+    float a1;
+    float a2;
+} AdcBiquadCoeffs;
+
+/**
+ * @brief Cascade of one channel: selected coefficient set and section states.
+ */
+typedef struct
+{
+    const AdcBiquadCoeffs *coeff;               //!< Selected set (numSections entries)
+    uint16_t numSections;                       //!< Sections in use
+    float w[ADC_BIQUAD_MAX_SECTIONS][2];        //!< DF2T state per section
+} AdcBiquadCascade;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Designs a notch (RBJ cookbook), unity gain away from f0.
+ *
+ * @param c Receives the section.
+ * @param f0Hz Notch frequency.
+ * @param fsHz Sample rate.
+ * @param q Quality factor (f0 / -3 dB bandwidth).
+ */
+void AdcBiquadDesignNotch(AdcBiquadCoeffs *c, float f0Hz, float fsHz, float q);
+
+/**
+ * @brief Designs a second-order low-pass (RBJ cookbook), unity DC gain.
+ *
+ * Cascading sections with the Butterworth Q values gives a Butterworth
+ * filter of higher order (order 4: Q = 0.5412 and 1.3066).
+ *
+ * @param c Receives the section.
+ * @param fcHz Cut-off frequency.
+ * @param fsHz Sample rate.
+ * @param q Quality factor (0.7071 for a single Butterworth section).
+ */
+void AdcBiquadDesignLowpass(AdcBiquadCoeffs *c, float fcHz, float fsHz, float q);
+
+/**
+ * @brief Selects a coefficient set and clears the state.
+ *
+ * @param cascade Cascade to set up.
+ * @param coeff Coefficient set (kept by reference, numSections entries).
+ * @param numSections 1 to ADC_BIQUAD_MAX_SECTIONS.
+ * @return false if numSections is out of range.
+ */
+bool AdcBiquadInit(AdcBiquadCascade *cascade, const AdcBiquadCoeffs *coeff,
+                   uint16_t numSections);
+
+/**
+ * @brief Switches to another coefficient set without clearing the state.
+ *
+ * Sections beyond the previous count start from zero. Must not run while
+ * the same cascade is being processed (e.g. call it from the ISR, or with
+ * the ISR disabled).
+ *
+ * @param cascade Cascade to switch.
+ * @param coeff New coefficient set.
+ * @param numSections 1 to ADC_BIQUAD_MAX_SECTIONS.
+ * @return false if numSections is out of range (set not changed).
+ */
+bool AdcBiquadSelect(AdcBiquadCascade *cascade, const AdcBiquadCoeffs *coeff,
+                     uint16_t numSections);
+
+/**
+ * @brief Clears the state of every section.
+ *
+ * @param cascade Cascade to clear.
+ */
+void AdcBiquadReset(AdcBiquadCascade *cascade);
+
+/**
+ * @brief Sets the state as if the input had been x forever (no start-up step).
+ *
+ * @param cascade Cascade to prime.
+ * @param x Constant input.
+ */
+void AdcBiquadPrime(AdcBiquadCascade *cascade, float x);
+
+/**
+ * @brief Filters a block of floats (in and out may be the same array).
+ *
+ * @param cascade Cascade to run.
+ * @param in Input samples.
+ * @param out Receives n outputs.
+ * @param n Number of samples.
+ */
+void AdcBiquadProcessBlock(AdcBiquadCascade *cascade, const float *in, float *out, size_t n);
+
+/**
+ * @brief Filters a block of raw codes of one channel (output in codes).
+ *
+ * @param cascade Cascade to run.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives n outputs.
+ */
+void AdcBiquadProcessCodes(AdcBiquadCascade *cascade, const uint16_t *in, size_t n,
+                           size_t stride, float *out);
+
+/**
+ * @brief Filters one sample through every section (inline, ISR use).
+ *
+ * @param cascade Cascade to run.
+ * @param x Input sample.
+ * @return Output sample.
+ */
+static inline float AdcBiquadStep(AdcBiquadCascade *cascade, float x)
+{
+    const AdcBiquadCoeffs *c = cascade->coeff;
+    float *w = &cascade->w[0][0];
+    uint16_t s;
+
+    for (s = 0; s < cascade->numSections; s++)
+    {
+        float y = c->b0 * x + w[0];
+
+        w[0] = c->b1 * x - c->a1 * y + w[1];
+        w[1] = c->b2 * x - c->a2 * y;
+        x = y;
+        c++;
+        w += 2;
+    }
+
+    return x;
+}
+
+#endif /* ADC_BIQUAD_H_ */
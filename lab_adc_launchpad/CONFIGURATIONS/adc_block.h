@@ -0,0 +1,44 @@
+/**
+ * @file adc_block.h
+ * @brief Header file for the block-wise code-to-voltage conversion kernel.
+ *
+ * This file contains the declaration of the kernel that converts a block of
+ * raw codes of one channel to voltages in one call. It only depends on the
+ * C standard headers, so the same source builds on the C28x (FPU32) and on a
+ * host PC (SSE2/AVX2) to process recorded captures.
+ *
+ * @date Created on: Apr 06, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_BLOCK_H_
+#define ADC_BLOCK_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Converts n codes of one channel to volts: out[i] = in[i * stride] * slope + intercept.
+ *
+ * Ideal conversion: slope = scale, intercept = -midScale * scale. A
+ * calibration (adc_calibration.c) folds its gain and offset into both.
+ *
+ * @param out Destination, n contiguous voltages.
+ * @param in First code of the channel.
+ * @param n Number of codes to convert.
+ * @param stride Distance between consecutive codes in words (1 for a
+ *               contiguous record, NUM_ADC_CHANNELS for AdcSample blocks).
+ * @param slope Volts per code.
+ * @param intercept Volts at code 0.
+ */
+void AdcConvertBlock(float *restrict out, const uint16_t *restrict in, size_t n,
+                     size_t stride, float slope, float intercept);
+
+#endif /* ADC_BLOCK_H_ */
@@ -0,0 +1,352 @@
+/**
+ * @file adc_calibration.c
+ * @brief Per-channel two-point gain/offset calibration.
+ *
+ * The ideal conversion of a channel is idealVolts = (code - midScale) * scale.
+ * A calibration record corrects it to volts = gain * idealVolts + offset.
+ * Both are folded into a slope and an intercept per channel,
+ *
+ *   slope     = gain * scale
+ *   intercept = offset - gain * midScale * scale
+ *
+ * so the calibrated conversion is still one multiply-add per sample
+ * (AdcCalResult(), AdcCalResultBlock() -> AdcConvertBlock(), and the PPB and
+ * oversampled variants AdcCalPpbResult(), AdcCalOversampleResult()).
+ *
+ * Storage: adcCalStore sits in section adccal, placed in FLASHN as NOLOAD, so
+ * neither the FLASH nor the RAM build writes it. The table image from
+ * AdcCalExport() is programmed there separately (UniFlash memory write or the
+ * Flash API); erased flash fails the magic check and the ideal table is used.
+ *
+ * @date Created on: Apr 13, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_calibration.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Smallest ideal voltage difference between the two reference points.
+ */
+#define ADC_CAL_MIN_SPAN_V      0.1f
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+// Stored calibration table in reserved flash (section adccal -> FLASHN, NOLOAD);
+// NOINIT: no zero-initialization record, the contents come from the flash
+#pragma DATA_SECTION(adcCalStore, "adccal")
+#pragma NOINIT(adcCalStore)
+AdcCalTable adcCalStore;
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+static AdcCalRecord calRecord[NUM_ADC_CHANNELS];    // Active records
+static float calSlope[NUM_ADC_CHANNELS];            // Volts per code
+static float calIntercept[NUM_ADC_CHANNELS];        // Volts at code 0
+static bool calLoaded = false;
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Returns the ideal voltage of a code (no calibration).
+ */
+static float AdcCalIdealVolts(uint16_t ch, float code)
+{
+    return (code - (float)adcChannels[ch].midScale) * adcChannels[ch].scale;
+}
+
+/**
+ * @brief Recomputes the slope and intercept of one channel from its record.
+ */
+static void AdcCalApply(uint16_t ch)
+{
+    float scale = adcChannels[ch].scale;
+
+    calSlope[ch] = calRecord[ch].gain * scale;
+    calIntercept[ch] = calRecord[ch].offset -
+                       calRecord[ch].gain * (float)adcChannels[ch].midScale * scale;
+}
+
+/**
+ * @brief One's-complement style sum of all words before the checksum field.
+ */
+static uint32_t AdcCalChecksum(const AdcCalTable *table)
+{
+    const uint16_t *word = (const uint16_t *)table;
+    uint16_t numWords = (uint16_t)((const uint16_t *)&table->checksum - word);
+    uint32_t sum = 0;
+    uint16_t i;
+
+    for (i = 0; i < numWords; i++)
+        sum += word[i];
+
+    return ~sum;
+}
+
+/**
+ * @brief Checks that a table is programmed, current and intact.
+ */
+static bool AdcCalIsValid(const AdcCalTable *table)
+{
+    uint16_t ch;
+
+    if ((table->magic != ADC_CAL_MAGIC) || (table->version != ADC_CAL_VERSION) ||
+        (table->numChannels != NUM_ADC_CHANNELS) ||
+        (table->checksum != AdcCalChecksum(table)))
+        return false;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        if ((fabsf(table->channel[ch].gain - 1.0f) > ADC_CAL_MAX_GAIN_ERROR) ||
+            (fabsf(table->channel[ch].offset) > ADC_CAL_MAX_OFFSET_V))
+            return false;
+    }
+
+    return true;
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Loads the stored calibration table, or the ideal one if it is invalid.
+ *
+ * @return true if the stored table was valid and is now active.
+ */
+bool AdcCalInit(void)
+{
+    uint16_t ch;
+
+    calLoaded = AdcCalIsValid(&adcCalStore);
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        if (calLoaded)
+        {
+            calRecord[ch] = adcCalStore.channel[ch];
+        }
+        else
+        {
+            calRecord[ch].gain = 1.0f;
+            calRecord[ch].offset = 0.0f;
+            calRecord[ch].codeLow = 0.0f;
+            calRecord[ch].codeHigh = 0.0f;
+            calRecord[ch].voltsLow = 0.0f;
+            calRecord[ch].voltsHigh = 0.0f;
+        }
+        AdcCalApply(ch);
+    }
+
+    return calLoaded;
+}
+
+/**
+ * @brief Returns true if the active calibration came from the stored table.
+ */
+bool AdcCalIsLoaded(void)
+{
+    return calLoaded;
+}
+
+/**
+ * @brief Averages polled conversions of one channel (AdcConversion()).
+ *
+ * Uses the software-forced SOCs, so it must run before an acquisition mode
+ * re-routes the SOC triggers.
+ *
+ * @param ch Channel index.
+ * @param numSamples Number of conversions to average (at least 1).
+ * @return Mean raw code (0 if ch is out of range).
+ */
+float AdcCalMeasureCode(uint16_t ch, uint16_t numSamples)
+{
+    uint16_t read[NUM_ADC_CHANNELS];
+    uint32_t sum = 0;
+    uint16_t i;
+
+    if (ch >= NUM_ADC_CHANNELS)
+        return 0.0f;
+
+    if (numSamples == 0U)
+        numSamples = 1U;
+
+    for (i = 0; i < numSamples; i++)
+    {
+        AdcConversion(read);
+        sum += read[ch];
+    }
+
+    return (float)sum / (float)numSamples;
+}
+
+/**
+ * @brief Derives and activates the calibration of one channel from two known inputs.
+ *
+ * gain   = (voltsHigh - voltsLow) / (ideal(codeHigh) - ideal(codeLow))
+ * offset = voltsLow - gain * ideal(codeLow)
+ *
+ * @param ch Channel index.
+ * @param codeLow Mean code measured with voltsLow applied.
+ * @param voltsLow Low reference input in volts.
+ * @param codeHigh Mean code measured with voltsHigh applied.
+ * @param voltsHigh High reference input in volts.
+ * @return false (calibration unchanged) if the points are too close or the
+ *         correction is outside ADC_CAL_MAX_GAIN_ERROR/ADC_CAL_MAX_OFFSET_V.
+ */
+bool AdcCalFromTwoPoints(uint16_t ch, float codeLow, float voltsLow,
+                         float codeHigh, float voltsHigh)
+{
+    float idealLow;
+    float idealHigh;
+    float gain;
+    float offset;
+
+    if (ch >= NUM_ADC_CHANNELS)
+        return false;
+
+    idealLow = AdcCalIdealVolts(ch, codeLow);
+    idealHigh = AdcCalIdealVolts(ch, codeHigh);
+    if (fabsf(idealHigh - idealLow) < ADC_CAL_MIN_SPAN_V)
+        return false;
+
+    gain = (voltsHigh - voltsLow) / (idealHigh - idealLow);
+    offset = voltsLow - gain * idealLow;
+
+    if ((fabsf(gain - 1.0f) > ADC_CAL_MAX_GAIN_ERROR) ||
+        (fabsf(offset) > ADC_CAL_MAX_OFFSET_V))
+        return false;
+
+    calRecord[ch].gain = gain;
+    calRecord[ch].offset = offset;
+    calRecord[ch].codeLow = codeLow;
+    calRecord[ch].codeHigh = codeHigh;
+    calRecord[ch].voltsLow = voltsLow;
+    calRecord[ch].voltsHigh = voltsHigh;
+    AdcCalApply(ch);
+
+    return true;
+}
+
+/**
+ * @brief Returns the active calibration record of one channel (NULL if out of range).
+ */
+const AdcCalRecord *AdcCalGetRecord(uint16_t ch)
+{
+    return (ch < NUM_ADC_CHANNELS) ? &calRecord[ch] : NULL;
+}
+
+/**
+ * @brief Returns the calibrated volts per code of one channel (0 if out of range).
+ */
+float AdcCalGetSlope(uint16_t ch)
+{
+    return (ch < NUM_ADC_CHANNELS) ? calSlope[ch] : 0.0f;
+}
+
+/**
+ * @brief Returns the calibrated volts at code 0 of one channel (0 if out of range).
+ */
+float AdcCalGetIntercept(uint16_t ch)
+{
+    return (ch < NUM_ADC_CHANNELS) ? calIntercept[ch] : 0.0f;
+}
+
+/**
+ * @brief Fills a table image of the active calibration, ready to be programmed.
+ *
+ * @param table Receives the records with magic, version and checksum set.
+ */
+void AdcCalExport(AdcCalTable *table)
+{
+    uint16_t ch;
+
+    table->magic = ADC_CAL_MAGIC;
+    table->version = ADC_CAL_VERSION;
+    table->numChannels = NUM_ADC_CHANNELS;
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        table->channel[ch] = calRecord[ch];
+    table->checksum = AdcCalChecksum(table);
+}
+
+/**
+ * @brief Returns the address of the reserved adccal flash section.
+ */
+const AdcCalTable *AdcCalGetStore(void)
+{
+    return &adcCalStore;
+}
+
+/**
+ * @brief Converts raw ADC results to calibrated voltages (one multiply-add each).
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param read Array containing raw ADC results (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcCalResult(float voltage[], const uint16_t read[])
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        voltage[ch] = (float)read[ch] * calSlope[ch] + calIntercept[ch];
+}
+
+/**
+ * @brief Converts the latest signed PPB results to calibrated voltages.
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcCalPpbResult(float voltage[])
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        float ppb = (float)ADC_readPPBResult(adcChannels[ch].resultBase, adcChannels[ch].ppb);
+
+        voltage[ch] = ppb * calSlope[ch] + calIntercept[ch] +
+                      calSlope[ch] * (float)adcChannels[ch].midScale;
+    }
+}
+
+/**
+ * @brief Converts oversampled codes to calibrated voltages.
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param code Array containing oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcCalOversampleResult(float voltage[], const uint32_t code[])
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        float slope = calSlope[ch] / (float)(1UL << AdcOversampleGetExtraBits(ch));
+
+        voltage[ch] = (float)code[ch] * slope + calIntercept[ch];
+    }
+}
+
+/**
+ * @brief Converts a block of raw results of one channel to calibrated voltages.
+ *
+ * @param out Array to store the voltages (minimum size: n).
+ * @param in First raw result of the channel.
+ * @param n Number of results to convert.
+ * @param stride Distance between consecutive results in words.
+ * @param ch Channel index.
+ */
+void AdcCalResultBlock(float *out, const uint16_t *in, size_t n, size_t stride,
+                       uint16_t ch)
+{
+    AdcConvertBlock(out, in, n, stride, calSlope[ch], calIntercept[ch]);
+}
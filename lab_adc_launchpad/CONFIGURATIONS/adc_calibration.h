@@ -0,0 +1,183 @@
+/**
+ * @file adc_calibration.h
+ * @brief Header file for the per-channel two-point gain/offset calibration.
+ *
+ * This file contains definitions and function declarations for correcting
+ * the ideal conversion constants (DIFFERENTIAL, SINGLE_ENDED) of each board.
+ * A calibration record holds the gain and offset relative to the ideal
+ * conversion together with the two reference points it was derived from.
+ * The table is stored in a reserved flash section (adccal -> FLASHN) that the
+ * application image does not program, so a board keeps its calibration when
+ * it is re-flashed and boots calibrated.
+ *
+ * @date Created on: Apr 13, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_CALIBRATION_H_
+#define ADC_CALIBRATION_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_config.h"     // adcChannels[], NUM_ADC_CHANNELS
+#include "adc_oversample.h" // AdcOversampleGetExtraBits()
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Marks a programmed calibration table ("ADCC"); erased flash reads 0xFFFFFFFF.
+ */
+#define ADC_CAL_MAGIC           0x41444343UL
+
+/**
+ * @brief Table layout version, bumped when AdcCalRecord changes.
+ */
+#define ADC_CAL_VERSION         1U
+
+/**
+ * @brief Accepted correction range; larger values indicate a wrong input level.
+ */
+#define ADC_CAL_MAX_GAIN_ERROR  0.1f    // |gain - 1|
+#define ADC_CAL_MAX_OFFSET_V    0.2f    // |offset| in volts
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Calibration of one channel: volts = gain * idealVolts + offset.
+ */
+typedef struct
+{
+    float gain;             //!< Gain relative to the ideal scale
+    float offset;           //!< Offset in volts after the gain
+    float codeLow;          //!< Mean code measured at the low reference
+    float codeHigh;         //!< Mean code measured at the high reference
+    float voltsLow;         //!< Low reference input in volts
+    float voltsHigh;        //!< High reference input in volts
+} AdcCalRecord;
+
+/**
+ * @brief Calibration table as stored in the adccal section.
+ */
+typedef struct
+{
+    uint32_t magic;                             //!< ADC_CAL_MAGIC when programmed
+    uint16_t version;                           //!< ADC_CAL_VERSION
+    uint16_t numChannels;                       //!< NUM_ADC_CHANNELS
+    AdcCalRecord channel[NUM_ADC_CHANNELS];     //!< One record per channel
+    uint32_t checksum;                          //!< AdcCalChecksum() of the words above
+} AdcCalTable;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Loads the stored calibration table, or the ideal one if it is invalid.
+ *
+ * @return true if the stored table was valid and is now active.
+ */
+bool AdcCalInit(void);
+
+/**
+ * @brief Returns true if the active calibration came from the stored table.
+ */
+bool AdcCalIsLoaded(void);
+
+/**
+ * @brief Averages polled conversions of one channel (AdcConversion()).
+ *
+ * @param ch Channel index.
+ * @param numSamples Number of conversions to average (at least 1).
+ * @return Mean raw code (0 if ch is out of range).
+ */
+float AdcCalMeasureCode(uint16_t ch, uint16_t numSamples);
+
+/**
+ * @brief Derives and activates the calibration of one channel from two known inputs.
+ *
+ * @param ch Channel index.
+ * @param codeLow Mean code measured with voltsLow applied.
+ * @param voltsLow Low reference input in volts.
+ * @param codeHigh Mean code measured with voltsHigh applied.
+ * @param voltsHigh High reference input in volts.
+ * @return false (calibration unchanged) if the points are too close or the
+ *         correction is outside ADC_CAL_MAX_GAIN_ERROR/ADC_CAL_MAX_OFFSET_V.
+ */
+bool AdcCalFromTwoPoints(uint16_t ch, float codeLow, float voltsLow,
+                         float codeHigh, float voltsHigh);
+
+/**
+ * @brief Returns the active calibration record of one channel (NULL if out of range).
+ */
+const AdcCalRecord *AdcCalGetRecord(uint16_t ch);
+
+/**
+ * @brief Returns the calibrated volts per code of one channel (0 if out of range).
+ */
+float AdcCalGetSlope(uint16_t ch);
+
+/**
+ * @brief Returns the calibrated volts at code 0 of one channel (0 if out of range).
+ */
+float AdcCalGetIntercept(uint16_t ch);
+
+/**
+ * @brief Fills a table image of the active calibration, ready to be programmed.
+ *
+ * @param table Receives the records with magic, version and checksum set.
+ */
+void AdcCalExport(AdcCalTable *table);
+
+/**
+ * @brief Returns the address of the reserved adccal flash section.
+ */
+const AdcCalTable *AdcCalGetStore(void);
+
+/**
+ * @brief Converts raw ADC results to calibrated voltages (one multiply-add each).
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param read Array containing raw ADC results (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcCalResult(float voltage[], const uint16_t read[]);
+
+/**
+ * @brief Converts the latest signed PPB results to calibrated voltages.
+ *
+ * The PPB has already subtracted midScale, so it is added back through the
+ * slope: volts = slope * ppb + intercept + slope * midScale.
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcCalPpbResult(float voltage[]);
+
+/**
+ * @brief Converts oversampled codes to calibrated voltages.
+ *
+ * The slope of each channel is divided by 2^(extra output bits) of that
+ * channel (AdcOversampleGetExtraBits()).
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param code Array containing oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcCalOversampleResult(float voltage[], const uint32_t code[]);
+
+/**
+ * @brief Converts a block of raw results of one channel to calibrated voltages.
+ *
+ * @param out Array to store the voltages (minimum size: n).
+ * @param in First raw result of the channel.
+ * @param n Number of results to convert.
+ * @param stride Distance between consecutive results in words.
+ * @param ch Channel index.
+ */
+void AdcCalResultBlock(float *out, const uint16_t *in, size_t n, size_t stride,
+                       uint16_t ch);
+
+#endif /* ADC_CALIBRATION_H_ */
@@ -0,0 +1,166 @@
+/**
+ * @file adc_cla.c
+ * @brief CLA-offloaded ADC conversion and running statistics (C28x side).
+ *
+ * This file loads the CLA program, hands two LS RAM blocks to CLA1, fills the
+ * CPU-to-CLA configuration from adcChannels[] and routes the ADCA1 trigger to
+ * CLA task 1 (adc_cla_tasks.cla). The message RAM variables are defined here,
+ * as the CLA compiler only references them.
+ *
+ * @date Created on: Mar 16, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_cla.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+#if (NUM_ADC_CHANNELS > ADC_CLA_MAX_CHANNELS)
+#error "adc_cla.c: more channels than ADC_CLA_MAX_CHANNELS"
+#endif
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+#pragma DATA_SECTION(adcClaConfig, "CpuToCla1MsgRAM")
+AdcClaConfig adcClaConfig;
+
+#pragma DATA_SECTION(adcClaStats, "Cla1ToCpuMsgRAM")
+volatile AdcClaStats adcClaStats;
+
+// CLA program and constant load/run addresses (linker command file)
+extern uint16_t Cla1ProgLoadStart;
+extern uint16_t Cla1ProgLoadSize;
+extern uint16_t Cla1ProgRunStart;
+extern uint16_t Cla1ConstLoadStart;
+extern uint16_t Cla1ConstLoadSize;
+extern uint16_t Cla1ConstRunStart;
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+static uint32_t claReadSequence = 0;    // Sequence of the last window returned
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Loads and starts the CLA acquisition task on the ADCA1 trigger.
+ *
+ * @param windowSamples Samples per published statistics window (at least 1).
+ */
+void AdcClaInit(uint32_t windowSamples)
+{
+    uint16_t ch;
+
+    if (windowSamples == 0U)
+        windowSamples = 1U;
+
+#ifdef _FLASH
+    // Copy the CLA program and constants from flash to their LS RAM run addresses
+    memcpy(&Cla1ProgRunStart, &Cla1ProgLoadStart, (size_t)&Cla1ProgLoadSize);
+    memcpy(&Cla1ConstRunStart, &Cla1ConstLoadStart, (size_t)&Cla1ConstLoadSize);
+#endif
+
+    //
+    // Memory: program and data LS RAM shared between CPU and CLA1
+    //
+    MemCfg_setLSRAMControllerSel(ADC_CLA_PROG_RAM, MEMCFG_LSRAMCONTROLLER_CPU_CLA1);
+    MemCfg_setCLAMemType(ADC_CLA_PROG_RAM, MEMCFG_CLA_MEM_PROGRAM);
+    MemCfg_setLSRAMControllerSel(ADC_CLA_DATA_RAM, MEMCFG_LSRAMCONTROLLER_CPU_CLA1);
+    MemCfg_setCLAMemType(ADC_CLA_DATA_RAM, MEMCFG_CLA_MEM_DATA);
+
+    //
+    // Configuration for task 1, taken from the channel descriptors
+    //
+    adcClaConfig.numChannels = NUM_ADC_CHANNELS;
+    adcClaConfig.intFlagClrAddr = (uint16_t)(adcChannels[0].base + ADC_O_INTFLGCLR);
+    adcClaConfig.windowSamples = windowSamples;
+    adcClaConfig.invWindow = 1.0f / (float)windowSamples;
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        adcClaConfig.channel[ch].midScale = (float)adcChannels[ch].midScale;
+        adcClaConfig.channel[ch].scale = adcChannels[ch].scale;
+        adcClaConfig.channel[ch].resultAddr =
+            (uint16_t)(adcChannels[ch].resultBase + ADC_RESULTx_OFFSET_BASE +
+                       (uint32_t)adcChannels[ch].soc);
+        adcClaConfig.channel[ch].rsvd = 0;
+    }
+
+    //
+    // CLA1: task vectors, then clear the CLA state with task 8
+    //
+    CLA_mapTaskVector(CLA1_BASE, CLA_MVECT_1, (uint16_t)&Cla1Task1);
+    CLA_mapTaskVector(CLA1_BASE, CLA_MVECT_8, (uint16_t)&Cla1Task8);
+    CLA_enableIACK(CLA1_BASE);
+    CLA_enableTasks(CLA1_BASE, CLA_TASKFLAG_1 | CLA_TASKFLAG_8);
+
+    CLA_forceTasks(CLA1_BASE, CLA_TASKFLAG_8);
+    while (CLA_getTaskRunStatus(CLA1_BASE, CLA_TASK_8) ||
+           CLA_getPendingTaskFlag(CLA1_BASE, CLA_TASK_8))
+    {
+        // Waiting for task 8 to finish
+    }
+    claReadSequence = 0;
+
+    //
+    // Trigger: ADCINT1 now starts task 1 instead of the CPU ISR
+    //
+    Interrupt_disable(INT_ADCA1);
+    ADC_clearInterruptStatus(adcChannels[0].base, ADC_INT_NUMBER1);
+    ADC_clearInterruptOverflowStatus(adcChannels[0].base, ADC_INT_NUMBER1);
+    CLA_clearTaskFlags(CLA1_BASE, CLA_TASKFLAG_1);
+    CLA_setTriggerSource(CLA_TASK_1, CLA_TRIGGER_ADCA1);
+}
+
+/**
+ * @brief Copies the latest statistics window if a new one was published.
+ *
+ * @param stats Receives the statistics block.
+ * @return true if the window is new since the previous call.
+ */
+bool AdcClaReadStats(AdcClaStats *stats)
+{
+    uint32_t sequence;
+    uint16_t ch;
+
+    if (adcClaStats.sequence == claReadSequence)
+        return false;
+
+    // Retry while the CLA is writing (odd) or wrote during the copy
+    do
+    {
+        sequence = adcClaStats.sequence;
+        if ((sequence & 1UL) != 0UL)
+            continue;
+        stats->samples = adcClaStats.samples;
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            stats->channel[ch] = adcClaStats.channel[ch];
+    } while (((sequence & 1UL) != 0UL) || (sequence != adcClaStats.sequence));
+
+    stats->sequence = sequence / 2UL;
+    claReadSequence = sequence;
+    return true;
+}
+
+/**
+ * @brief Returns true if an ADCA1 trigger arrived while task 1 was still pending.
+ *
+ * The flag is cleared by the call.
+ */
+bool AdcClaTaskOverflowed(void)
+{
+    if (!CLA_getTaskOverflowFlag(CLA1_BASE, CLA_TASK_1))
+        return false;
+
+    // No driverlib helper for MICLROVF; it is EALLOW protected like MICLR
+    EALLOW;
+    HWREGH(CLA1_BASE + CLA_O_MICLROVF) = CLA_MICLROVF_INT1;
+    EDIS;
+    return true;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file adc_cla.h
+ * @brief Header file for CLA-offloaded ADC conversion and statistics.
+ *
+ * This file contains definitions and function declarations for running the
+ * per-sample work on CLA1. ADCA interrupt 1 triggers CLA task 1, which reads
+ * the results, scales them to volts and keeps running statistics in CLA
+ * message RAM. The C28x only picks up finished statistics windows.
+ *
+ * @date Created on: Mar 16, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_CLA_H_
+#define ADC_CLA_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"              // Include SysConfig generated header
+#include "adc_config.h"         // adcChannels[]
+#include "adc_cla_shared.h"     // Message RAM layout, CLA tasks
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief LS RAM blocks given to CLA1 (must match the linker command file).
+ *
+ * Cla1Prog runs from RAMLS4; .bss_cla, .scratchpad and .const_cla use RAMLS2.
+ */
+#define ADC_CLA_PROG_RAM        MEMCFG_SECT_LS4
+#define ADC_CLA_DATA_RAM        MEMCFG_SECT_LS2
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Loads and starts the CLA acquisition task on the ADCA1 trigger.
+ *
+ * AdcAcquisitionInit() must be called first: it routes the channel SOCs to
+ * the ePWM sample clock. The ADCA1 CPU interrupt is then disabled, because
+ * CLA task 1 consumes and clears ADCINT1.
+ *
+ * @param windowSamples Samples per published statistics window (at least 1).
+ */
+void AdcClaInit(uint32_t windowSamples);
+
+/**
+ * @brief Copies the latest statistics window if a new one was published.
+ *
+ * Never returns a window the CLA is still writing (sequence lock); the
+ * copied sequence is the number of windows published.
+ *
+ * @param stats Receives the statistics block.
+ * @return true if the window is new since the previous call.
+ */
+bool AdcClaReadStats(AdcClaStats *stats);
+
+/**
+ * @brief Returns true if an ADCA1 trigger arrived while task 1 was still pending.
+ *
+ * The flag is cleared by the call.
+ */
+bool AdcClaTaskOverflowed(void);
+
+#endif /* ADC_CLA_H_ */
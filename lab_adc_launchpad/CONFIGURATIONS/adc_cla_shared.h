@@ -0,0 +1,110 @@
+/**
+ * @file adc_cla_shared.h
+ * @brief Data shared between the C28x and the CLA acquisition task.
+ *
+ * This file is included by both adc_cla.c (C28x) and adc_cla_tasks.cla (CLA),
+ * so it only uses fixed-size types whose layout is identical on both cores
+ * (32-bit values on even word offsets). Nothing from driverlib beyond the
+ * register maps is used here, because the CLA compiler cannot build the
+ * C28x driver functions.
+ *
+ * @date Created on: Mar 16, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_CLA_SHARED_H_
+#define ADC_CLA_SHARED_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include "inc/hw_types.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_adc.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Channels the CLA task can process (sizes the message RAM structures).
+ *
+ * CPU-to-CLA and CLA-to-CPU message RAMs are 128 words each.
+ */
+#define ADC_CLA_MAX_CHANNELS    4U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Conversion settings of one channel (copied from adcChannels[]).
+ */
+typedef struct
+{
+    float midScale;         //!< Code subtracted before scaling
+    float scale;            //!< Volts per code (DIFFERENTIAL or SINGLE_ENDED)
+    uint16_t resultAddr;    //!< Address of the channel's ADC result register
+    uint16_t rsvd;          //!< Keeps the size even on both cores
+} AdcClaChannelConfig;
+
+/**
+ * @brief CPU-to-CLA configuration (CpuToCla1MsgRAM).
+ */
+typedef struct
+{
+    uint16_t numChannels;       //!< Channels to process (<= ADC_CLA_MAX_CHANNELS)
+    uint16_t intFlagClrAddr;    //!< ADCINTFLGCLR of the triggering converter
+    uint32_t windowSamples;     //!< Samples per published statistics window
+    float invWindow;            //!< 1 / windowSamples (the CLA has no divider)
+    uint16_t rsvd[2];           //!< Keeps channel[] on an even offset
+    AdcClaChannelConfig channel[ADC_CLA_MAX_CHANNELS];
+} AdcClaConfig;
+
+/**
+ * @brief Statistics of one channel over one window.
+ */
+typedef struct
+{
+    float last;             //!< Last voltage of the window
+    float min;              //!< Minimum voltage
+    float max;              //!< Maximum voltage
+    float mean;             //!< Average voltage
+    uint16_t lastCode;      //!< Raw code of the last sample
+    uint16_t rsvd;          //!< Keeps the size even on both cores
+} AdcClaChannelStats;
+
+/**
+ * @brief CLA-to-CPU statistics (Cla1ToCpuMsgRAM).
+ *
+ * Sequence lock: the CLA makes sequence odd before it writes the window and
+ * even again afterwards. A reader retries while sequence is odd or changes
+ * across its copy.
+ */
+typedef struct
+{
+    uint32_t sequence;      //!< Twice the windows published; odd during an update
+    uint32_t samples;       //!< Samples in each published window
+    AdcClaChannelStats channel[ADC_CLA_MAX_CHANNELS];
+} AdcClaStats;
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+extern AdcClaConfig adcClaConfig;   // Written by the C28x, read by the CLA
+extern volatile AdcClaStats adcClaStats;    // Written by the CLA, read by the C28x
+
+/*********************************************************************************
+ * CLA Tasks
+ *********************************************************************************/
+/**
+ * @brief Task 1 (ADCA1 trigger): converts one sample and updates the statistics.
+ */
+__interrupt void Cla1Task1(void);
+
+/**
+ * @brief Task 8 (software forced): clears the accumulators and published stats.
+ */
+__interrupt void Cla1Task8(void);
+
+#endif /* ADC_CLA_SHARED_H_ */
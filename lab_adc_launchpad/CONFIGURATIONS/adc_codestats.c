@@ -0,0 +1,146 @@
+/**
+ * @file adc_codestats.c
+ * @brief Integer-domain raw-code statistics with deferred voltage conversion.
+ *
+ * This file contains functions that accumulate exact 64-bit sums of code
+ * deviations and convert them to mean and variance in volts once per report.
+ *
+ * @date Created on: Apr 27, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_codestats.h"
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Clears the statistics.
+ *
+ * @param stats Statistics to reset.
+ */
+void AdcCodeStatsReset(AdcCodeStats *stats)
+{
+    stats->count = 0;
+    stats->ref = 0;
+    stats->min = 0xFFFFU;
+    stats->max = 0;
+    stats->rsvd = 0;
+    stats->sum = 0;
+    stats->sumSq = 0;
+}
+
+/**
+ * @brief Adds one code.
+ *
+ * @param stats Statistics to update.
+ * @param code Raw ADC code.
+ */
+void AdcCodeStatsUpdate(AdcCodeStats *stats, uint16_t code)
+{
+    int32_t d;
+    uint32_t ad;
+
+    if (stats->count == 0U)
+        stats->ref = code;
+
+    if (code < stats->min) stats->min = code;
+    if (code > stats->max) stats->max = code;
+
+    d = (int32_t)code - (int32_t)stats->ref;
+    ad = (uint32_t)((d < 0) ? -d : d);
+    stats->sum += d;
+    stats->sumSq += ad * ad;
+    stats->count++;
+}
+
+/**
+ * @brief Adds a block of codes of one channel.
+ *
+ * Accumulates in locals and writes the statistics back once per block.
+ *
+ * @param stats Statistics to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcCodeStatsUpdateBlock(AdcCodeStats *stats, const uint16_t *in, size_t n,
+                             size_t stride)
+{
+    int32_t ref;
+    uint16_t vMin = stats->min;
+    uint16_t vMax = stats->max;
+    int64_t sum = 0;
+    uint64_t sumSq = 0;
+    size_t i;
+
+    if (n == 0U)
+        return;
+    if (stats->count == 0U)
+        stats->ref = in[0];
+    ref = (int32_t)stats->ref;
+
+    for (i = 0; i < n; i++)
+    {
+        uint16_t code = in[i * stride];
+        int32_t d = (int32_t)code - ref;
+        uint32_t ad = (uint32_t)((d < 0) ? -d : d);
+
+        if (code < vMin) vMin = code;
+        if (code > vMax) vMax = code;
+        sum += d;
+        sumSq += ad * ad;
+    }
+
+    stats->min = vMin;
+    stats->max = vMax;
+    stats->sum += sum;
+    stats->sumSq += sumSq;
+    stats->count += (uint32_t)n;
+}
+
+/**
+ * @brief Converts raw-code statistics to volts (report time only).
+ *
+ * @param stats Raw-code statistics.
+ * @param slope Volts per code.
+ * @param intercept Volts at code 0.
+ * @param out Receives count, mean, m2, min and max in volts.
+ */
+void AdcCodeStatsToVolts(const AdcCodeStats *stats, float slope, float intercept,
+                         AdcStats *out)
+{
+    double n = (double)stats->count;
+    double sum = (double)stats->sum;
+    double meanCode;
+    double m2Code;
+    float vMin;
+    float vMax;
+
+    out->count = stats->count;
+    if (stats->count == 0U)
+    {
+        out->mean = 0.0f;
+        out->m2 = 0.0f;
+        out->min = 0.0f;
+        out->max = 0.0f;
+        return;
+    }
+
+    meanCode = (double)stats->ref + sum / n;
+    m2Code = (double)stats->sumSq - (sum * sum) / n;
+    if (m2Code < 0.0)
+        m2Code = 0.0;
+
+    vMin = (float)stats->min * slope + intercept;
+    vMax = (float)stats->max * slope + intercept;
+
+    out->mean = (float)(meanCode * (double)slope + (double)intercept);
+    out->m2 = (float)(m2Code * (double)slope * (double)slope);
+    out->min = (slope >= 0.0f) ? vMin : vMax;
+    out->max = (slope >= 0.0f) ? vMax : vMin;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file adc_codestats.h
+ * @brief Header file for integer-domain raw-code statistics.
+ *
+ * This file contains definitions and function declarations for statistics
+ * accumulated on raw ADC codes and converted to volts at report time.
+ *
+ * @date Created on: Apr 27, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_CODESTATS_H_
+#define ADC_CODESTATS_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+#include "adc_stats.h"      // AdcStats (report format)
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Raw-code statistics of one channel.
+ *
+ * Sums are of d = code - ref, with ref the first code, which keeps the sum of
+ * squares small around a DC level and the variance free of cancellation.
+ */
+typedef struct
+{
+    uint32_t count;         //!< Samples accumulated
+    uint16_t ref;           //!< Reference code (first sample)
+    uint16_t min;           //!< Smallest code
+    uint16_t max;           //!< Largest code
+    uint16_t rsvd;          //!< Padding
+    int64_t sum;            //!< Sum of (code - ref)
+    uint64_t sumSq;         //!< Sum of (code - ref)^2
+} AdcCodeStats;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Clears the statistics.
+ *
+ * @param stats Statistics to reset.
+ */
+void AdcCodeStatsReset(AdcCodeStats *stats);
+
+/**
+ * @brief Adds one code.
+ *
+ * @param stats Statistics to update.
+ * @param code Raw ADC code.
+ */
+void AdcCodeStatsUpdate(AdcCodeStats *stats, uint16_t code);
+
+/**
+ * @brief Adds a block of codes of one channel.
+ *
+ * @param stats Statistics to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcCodeStatsUpdateBlock(AdcCodeStats *stats, const uint16_t *in, size_t n,
+                             size_t stride);
+
+/**
+ * @brief Converts raw-code statistics to volts (report time only).
+ *
+ * @param stats Raw-code statistics.
+ * @param slope Volts per code.
+ * @param intercept Volts at code 0.
+ * @param out Receives count, mean, m2, min and max in volts.
+ */
+void AdcCodeStatsToVolts(const AdcCodeStats *stats, float slope, float intercept,
+                         AdcStats *out);
+
+#endif /* ADC_CODESTATS_H_ */
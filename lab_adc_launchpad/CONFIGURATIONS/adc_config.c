@@ -14,6 +14,40 @@
  *********************************************************************************/
 #include "adc_config.h"
 
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Builds one AdcChannelDescriptor initializer from a table entry.
+ */
+#define ADC_CHANNEL_DESCRIPTOR(instance, soc, ppb, mode, res, mid, volts, label) \
+    {                                                                           \
+        instance##_BASE, instance##_RESULT_BASE, instance##_SOC##soc,           \
+        ADC_PPB_NUMBER##ppb, instance##_CHANNEL_SOC##soc, mode, res,            \
+        ((res) == ADC_RESOLUTION_16BIT) ? 65535U : 4095U,                       \
+        mid, volts, label                                                       \
+    },
+
+/**
+ * @brief Converts one channel with its table constants (no per-channel branch).
+ */
+#define ADC_CHANNEL_TO_VOLTS(instance, soc, ppb, mode, res, mid, volts, label) \
+    voltage[ch] = (float)((int32_t)read[ch] - (int32_t)(mid)) * (volts);       \
+    ch++;
+
+/**
+ * @brief Both PPB limit event flags.
+ */
+#define ADC_PPB_LIMIT_EVENTS    (ADC_EVT_TRIPHI | ADC_EVT_TRIPLO)
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+const AdcChannelDescriptor adcChannels[NUM_ADC_CHANNELS] =
+{
+    ADC_CHANNEL_TABLE(ADC_CHANNEL_DESCRIPTOR)
+};
+
 /*********************************************************************************
  * Code
  *********************************************************************************/
@@ -24,78 +58,147 @@
  * Initiates ADC conversions for configured channels, waits for the results to
  * become available, and reads the results into the provided array.
  *
- * Note: This function uses SysConfig-generated macros for ADC instances.
- * The instance names (myADCA, myADCB) are defined in board.h
- *
- * Channel mapping:
- * - Channel 0: ADCA SOC0 (Differential ADCINA0-ADCINA1, 16-bit)
- * - Channel 1: ADCB SOC0 (Single-ended ADCINB2, 12-bit)
+ * Channels are converted one at a time in table order. ADCINT1 of the
+ * converter is pointed at the channel's SOC first, so several channels on
+ * the same converter are also handled.
  *
- * LaunchPad Pin Mapping:
- * - ADCINA0: Pin A0 on analog header
- * - ADCINA1: Pin A1 on analog header
- * - ADCINB2: Pin A10 on analog header (B0 not available on LaunchPad)
+ * LaunchPad Pin Mapping (default table):
+ * - Channel 0: ADCINA0-ADCINA1, pins A0 and A1 (differential, 16-bit)
+ * - Channel 1: ADCINB2, pin A10 (single-ended, 12-bit; B0 not available on LaunchPad)
  *
- * @param read Array to store the raw ADC conversion results (minimum size: 2).
+ * @param read Array to store the raw ADC conversion results (minimum size: NUM_ADC_CHANNELS).
  */
 void AdcConversion(uint16_t read[])
 {
-    // ADC A (myADCA): Force and read SOC0
-    // Differential channel: ADCINA0-ADCINA1 (16-bit)
-    // LaunchPad pins: A0 and A1
-    ADC_forceSOC(myADCA_BASE, myADCA_SOC0);
-    
-    // Wait for conversion to complete (polling ADC interrupt flag)
-    while (ADC_getInterruptStatus(myADCA_BASE, ADC_INT_NUMBER1) == false) 
-    {
-        // Waiting for ADCINT1 flag
-    }
-    ADC_clearInterruptStatus(myADCA_BASE, ADC_INT_NUMBER1);
-    
-    // Read result from ADCA
-    read[0] = ADC_readResult(myADCA_RESULT_BASE, myADCA_SOC0);
-
-    // ADC B (myADCB): Force and read SOC0
-    // Single-ended channel: ADCINB2 (12-bit)
-    // LaunchPad pin: A10
-    ADC_forceSOC(myADCB_BASE, myADCB_SOC0);
-    
-    // Wait for conversion to complete
-    while (ADC_getInterruptStatus(myADCB_BASE, ADC_INT_NUMBER1) == false) 
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
     {
-        // Waiting for ADCINT1 flag
+        const AdcChannelDescriptor *desc = &adcChannels[ch];
+
+        ADC_setInterruptSource(desc->base, ADC_INT_NUMBER1, desc->soc);
+        ADC_clearInterruptStatus(desc->base, ADC_INT_NUMBER1);
+        ADC_forceSOC(desc->base, desc->soc);
+
+        // Wait for conversion to complete (polling ADC interrupt flag)
+        while (ADC_getInterruptStatus(desc->base, ADC_INT_NUMBER1) == false)
+        {
+            // Waiting for ADCINT1 flag
+        }
+        ADC_clearInterruptStatus(desc->base, ADC_INT_NUMBER1);
+
+        read[ch] = ADC_readResult(desc->resultBase, desc->soc);
     }
-    ADC_clearInterruptStatus(myADCB_BASE, ADC_INT_NUMBER1);
-    
-    // Read result from ADCB
-    read[1] = ADC_readResult(myADCB_RESULT_BASE, myADCB_SOC0);
 }
 
 /**
  * @brief Converts raw ADC results to voltage values.
  *
  * Translates raw ADC results into voltage values based on the configured signal
- * mode (differential or single-ended).
+ * mode (differential or single-ended): voltage = (raw - midScale) * scale.
+ * The statements are expanded from ADC_CHANNEL_TABLE, so the mid-scale and
+ * scale of every channel are compile-time constants.
  *
- * Channel mapping:
- * - Channel 0 (ADCA SOC0): Differential 16-bit (ADCIN0-ADCIN1)
- * - Channel 1 (ADCB SOC0): Single-ended 12-bit (ADCIN0)
+ * Voltage range: 0-3.3V for all channels
  *
- * Voltage range: 0-3.3V for both channels
- *
- * @param voltage Array to store the calculated voltage values (minimum size: 2).
- * @param read Array containing raw ADC results (minimum size: 2).
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param read Array containing raw ADC results (minimum size: NUM_ADC_CHANNELS).
  */
 void AdcResult(float voltage[], uint16_t read[])
 {
-    // Channel 0: Differential (16-bit resolution)
-    // For differential mode, raw value represents signed voltage
-    // Center point is at 32768 (mid-scale)
-    // Convert to voltage: (raw - 32768) * scale_factor
-    int32_t signedValue = (int32_t)read[0] - 32768;
-    voltage[0] = (float)signedValue * DIFFERENTIAL;
-    
-    // Channel 1: Single-ended (12-bit resolution)
-    // Direct conversion: raw * scale_factor
-    voltage[1] = (float)read[1] * SINGLE_ENDED;
+    uint16_t ch = 0;
+
+    ADC_CHANNEL_TABLE(ADC_CHANNEL_TO_VOLTS)
+}
+
+/**
+ * @brief Converts a block of raw results of one channel to voltage values.
+ *
+ * Same conversion as AdcResult() for n results of one channel in one call,
+ * e.g. a channel of a DMA block; see AdcConvertBlock() in adc_block.c.
+ *
+ * @param out Array to store the voltages (minimum size: n).
+ * @param in First raw result of the channel.
+ * @param n Number of results to convert.
+ * @param stride Distance between consecutive results in words (1 for a
+ *               contiguous record, NUM_ADC_CHANNELS for AdcSample blocks).
+ * @param desc Channel providing midScale and scale.
+ */
+void AdcResultBlock(float *out, const uint16_t *in, size_t n, size_t stride,
+                    const AdcChannelDescriptor *desc)
+{
+    AdcConvertBlock(out, in, n, stride, desc->scale,
+                    -(float)desc->midScale * desc->scale);
+}
+
+/**
+ * @brief Sets up the post-processing block of every channel.
+ *
+ * PPB result = ADCRESULT - midScale (two's complement stays disabled, since
+ * it would return midScale - ADCRESULT). The trip window is the raw code
+ * range [margin, maxCode - margin] moved by the same offset, which replaces
+ * the software limit compare: ADC_EVT_TRIPHI/TRIPLO latch as soon as a
+ * conversion leaves the window.
+ */
+void AdcPpbInit(void)
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcChannelDescriptor *desc = &adcChannels[ch];
+        int32_t margin = (desc->resolution == ADC_RESOLUTION_16BIT) ?
+                         (int32_t)ADC_LIMIT_MARGIN_16BIT : (int32_t)ADC_LIMIT_MARGIN_12BIT;
+        int32_t mid = (int32_t)desc->midScale;
+
+        ADC_setupPPB(desc->base, desc->ppb, desc->soc);
+        ADC_setPPBReferenceOffset(desc->base, desc->ppb, desc->midScale);
+        ADC_disablePPBTwosComplement(desc->base, desc->ppb);
+        ADC_setPPBTripLimits(desc->base, desc->ppb,
+                             (int32_t)desc->maxCode - margin - mid, margin - mid);
+        ADC_clearPPBEventStatus(desc->base, desc->ppb, ADC_PPB_LIMIT_EVENTS);
+    }
+}
+
+/**
+ * @brief Converts the latest signed PPB results to voltage values.
+ *
+ * The offset is already removed by the PPB, so only the scale is applied.
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcPpbResult(float voltage[])
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        voltage[ch] = (float)ADC_readPPBResult(adcChannels[ch].resultBase,
+                                               adcChannels[ch].ppb) * adcChannels[ch].scale;
+    }
+}
+
+/**
+ * @brief Returns and clears the latched PPB limit events.
+ *
+ * @return Bit ch set if channel ch tripped its high or low limit since the
+ *         previous call (or AdcPpbInit()).
+ */
+uint16_t AdcPpbGetLimitEvents(void)
+{
+    uint16_t ch;
+    uint16_t events = 0;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcChannelDescriptor *desc = &adcChannels[ch];
+
+        if ((ADC_getPPBEventStatus(desc->base, desc->ppb) & ADC_PPB_LIMIT_EVENTS) != 0U)
+        {
+            ADC_clearPPBEventStatus(desc->base, desc->ppb, ADC_PPB_LIMIT_EVENTS);
+            events |= (uint16_t)(1U << ch);
+        }
+    }
+
+    return events;
 }
\ No newline at end of file
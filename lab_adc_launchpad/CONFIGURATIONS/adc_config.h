@@ -24,6 +24,7 @@
 #include "driverlib.h"
 #include "device.h"
 #include "board.h"  // Include SysConfig generated header
+#include "adc_block.h"  // Block conversion kernel
 
 /*********************************************************************************
  * Defines
@@ -45,9 +46,82 @@
 #define SINGLE_ENDED    0.00080566406F
 
 /**
- * @brief Number of ADC channels to read.
+ * @brief Acquired channel table.
+ *
+ * One X(...) entry per channel, in acquisition order:
+ *   X(instance, soc, ppb, signalMode, resolution, midScale, scale, name)
+ * - instance:   SysConfig ADC instance; <instance>_BASE, <instance>_RESULT_BASE,
+ *               <instance>_SOC<soc> and <instance>_CHANNEL_SOC<soc> come from board.h
+ * - soc:        SOC number of the channel on that converter
+ * - ppb:        post-processing block (1-4) of that converter, unique per converter
+ * - midScale:   code subtracted before scaling (differential zero point); also
+ *               the PPB reference offset, so 12-bit channels need a 12-bit value
+ * - scale:      volts per code (DIFFERENTIAL or SINGLE_ENDED)
+ * - name:       display name, padded to 9 characters
+ *
+ * Adding a channel is a new entry here plus its SOC in SysConfig. Entry 0 is
+ * the converter that raises ADCINT1 for interrupt-driven acquisition.
+ */
+#define ADC_CHANNEL_TABLE(X)                                                            \
+    X(myADCA, 0, 1, ADC_MODE_DIFFERENTIAL, ADC_RESOLUTION_16BIT, 32768U, DIFFERENTIAL, "ADCA-Diff") \
+    X(myADCB, 0, 1, ADC_MODE_SINGLE_ENDED, ADC_RESOLUTION_12BIT, 0U,     SINGLE_ENDED, "ADCB-SE  ")
+
+/**
+ * @brief Expands a table entry to +1, used to count the entries.
+ */
+#define ADC_CHANNEL_COUNT(instance, soc, ppb, mode, res, midScale, scale, name)  + 1
+
+/**
+ * @brief Number of ADC channels to read (entries in ADC_CHANNEL_TABLE).
+ */
+#define NUM_ADC_CHANNELS    (0 ADC_CHANNEL_TABLE(ADC_CHANNEL_COUNT))
+
+/**
+ * @brief SOC sample window in SYSCLK cycles.
+ *
+ * Same value as SysConfig (myADCx_SAMPLE_WINDOW_SOC0 = 1000 ns at 200 MHz);
+ * used when SOCs are reconfigured at run time.
+ */
+#define ADC_SAMPLE_WINDOW   200U
+
+/**
+ * @brief Codes kept clear of each rail by the PPB limit check.
+ *
+ * A reading within this margin of 0 or full scale is treated as stuck at a
+ * limit (input floating or saturated).
+ */
+#define ADC_LIMIT_MARGIN_16BIT  100U
+#define ADC_LIMIT_MARGIN_12BIT  10U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Descriptor of one acquired channel (built from ADC_CHANNEL_TABLE).
  */
-#define NUM_ADC_CHANNELS    2
+typedef struct
+{
+    uint32_t base;              //!< ADC module base
+    uint32_t resultBase;        //!< ADC result register base
+    ADC_SOCNumber soc;          //!< SOC converting this channel
+    ADC_PPBNumber ppb;          //!< Post-processing block linked to the SOC
+    ADC_Channel channel;        //!< Input selected in SysConfig
+    ADC_SignalMode signalMode;  //!< Single-ended or differential
+    ADC_Resolution resolution;  //!< 12-bit or 16-bit
+    uint16_t maxCode;           //!< Full-scale code (4095 or 65535)
+    uint16_t midScale;          //!< Code subtracted before scaling
+    float scale;                //!< Volts per code
+    const char *name;           //!< Display name (9 characters)
+} AdcChannelDescriptor;
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+/**
+ * @brief Descriptor table, one entry per channel in acquisition order.
+ */
+extern const AdcChannelDescriptor adcChannels[NUM_ADC_CHANNELS];
 
 /*********************************************************************************
  * Functions
@@ -59,7 +133,7 @@
  * Initiates ADC conversions for configured channels, waits for the results to
  * become available, and reads the results into the provided array.
  *
- * @param read Array to store the raw ADC conversion results (minimum size: 2).
+ * @param read Array to store the raw ADC conversion results (minimum size: NUM_ADC_CHANNELS).
  */
 void AdcConversion(uint16_t read[]);
 
@@ -69,9 +143,47 @@ void AdcConversion(uint16_t read[]);
  * Translates raw ADC results into voltage values based on the configured signal
  * mode (differential or single-ended).
  *
- * @param voltage Array to store the calculated voltage values (minimum size: 2).
- * @param read Array containing raw ADC results (minimum size: 2).
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param read Array containing raw ADC results (minimum size: NUM_ADC_CHANNELS).
  */
 void AdcResult(float voltage[], uint16_t read[]);
 
+/**
+ * @brief Converts a block of raw results of one channel to voltage values.
+ *
+ * @param out Array to store the voltages (minimum size: n).
+ * @param in First raw result of the channel.
+ * @param n Number of results to convert.
+ * @param stride Distance between consecutive results in words (1 for a
+ *               contiguous record, NUM_ADC_CHANNELS for AdcSample blocks).
+ * @param desc Channel providing midScale and scale.
+ */
+void AdcResultBlock(float *out, const uint16_t *in, size_t n, size_t stride,
+                    const AdcChannelDescriptor *desc);
+
+/**
+ * @brief Sets up the post-processing block of every channel.
+ *
+ * Each PPB subtracts midScale from its SOC result and compares the signed
+ * result against the limit window, so offset removal and limit detection
+ * happen in hardware at the end of every conversion. Must be called after
+ * Board_init().
+ */
+void AdcPpbInit(void);
+
+/**
+ * @brief Converts the latest signed PPB results to voltage values.
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcPpbResult(float voltage[]);
+
+/**
+ * @brief Returns and clears the latched PPB limit events.
+ *
+ * @return Bit ch set if channel ch tripped its high or low limit since the
+ *         previous call (or AdcPpbInit()).
+ */
+uint16_t AdcPpbGetLimitEvents(void);
+
 #endif /* ADC_CONFIG_H_ */
\ No newline at end of file
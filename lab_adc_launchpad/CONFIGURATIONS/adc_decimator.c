@@ -0,0 +1,201 @@
+/**
+ * @file adc_decimator.c
+ * @brief CIC + compensation-FIR decimation stage.
+ *
+ * This file contains the third-order CIC filter and the 3-tap FIR that
+ * corrects its passband droop and gain.
+ *
+ * @date Created on: Jun 08, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_decimator.h"
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Runs the combs and the FIR for one CIC output.
+ */
+static int32_t AdcDecimatorOutput(AdcDecimator *dec, uint64_t sample)
+{
+    uint64_t c = sample;
+    int64_t v64;
+    int32_t v;
+    int64_t acc;
+    uint16_t i;
+
+    for (i = 0; i < ADC_DECIM_ORDER; i++)
+    {
+        uint64_t d = c - dec->comb[i];
+        dec->comb[i] = c;
+        c = d;
+    }
+
+    // Two's complement result of the modular combs
+    if (dec->wide)
+        v64 = (int64_t)c;
+    else
+        v64 = (int64_t)(int32_t)(uint32_t)c;
+    v = (int32_t)(v64 >> dec->shift);
+
+    // Symmetric FIR: h0 (x[n] + x[n-2]) + h1 x[n-1]
+    acc = (int64_t)dec->coeff[0] * ((int64_t)v + dec->history[1]) +
+          (int64_t)dec->coeff[1] * dec->history[0];
+    dec->history[1] = dec->history[0];
+    dec->history[0] = v;
+
+    dec->outputs++;
+
+    return (int32_t)((acc + (1LL << (ADC_DECIM_COEFF_SHIFT - 1U))) >> ADC_DECIM_COEFF_SHIFT) +
+           ((int32_t)dec->centre << ADC_DECIM_FRAC_BITS);
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Sets the ratio and input resolution of a decimator and clears it.
+ *
+ * @param dec Decimator to initialize.
+ * @param ratio Decimation ratio (ADC_DECIM_MIN_RATIO to ADC_DECIM_MAX_RATIO).
+ * @param inputBits Resolution of the input codes (12 or 16).
+ * @return false if a parameter is out of range.
+ */
+bool AdcDecimatorInit(AdcDecimator *dec, uint16_t ratio, uint16_t inputBits)
+{
+    uint64_t gain;
+    uint16_t gainBits = 0;
+    uint16_t growth = 0;
+    float a;
+    float correction;
+
+    if ((ratio < ADC_DECIM_MIN_RATIO) || (ratio > ADC_DECIM_MAX_RATIO) ||
+        (inputBits < 2U) || (inputBits > 16U))
+        return false;
+
+    // floor(log2(R^3)) and the register width needed (ceil(log2 R) per stage)
+    gain = (uint64_t)ratio * ratio * ratio;
+    while ((gain >> (gainBits + 1U)) != 0U)
+        gainBits++;
+    while ((1UL << growth) < ratio)
+        growth++;
+
+    dec->ratio = ratio;
+    dec->centre = (uint16_t)(1UL << (inputBits - 1U));
+    dec->shift = gainBits - ADC_DECIM_FRAC_BITS;
+    dec->wide = (inputBits + ADC_DECIM_ORDER * growth) > 32U;
+    dec->outputs = 0;
+    AdcDecimatorReset(dec);
+
+    // h = [1, A, 1] / (A + 2), times 2^gainBits / R^3
+    a = -2.0f - 24.0f / (float)ADC_DECIM_ORDER;
+    correction = (float)(1ULL << gainBits) / (float)gain;
+    dec->coeff[0] = (int32_t)(correction / (a + 2.0f) * (float)(1UL << ADC_DECIM_COEFF_SHIFT) - 0.5f);
+    dec->coeff[1] = (int32_t)(correction * a / (a + 2.0f) * (float)(1UL << ADC_DECIM_COEFF_SHIFT) + 0.5f);
+    dec->coeff[2] = dec->coeff[0];
+
+    return true;
+}
+
+/**
+ * @brief Clears the CIC and FIR states, keeping the ratio (e.g. after lost samples).
+ *
+ * @param dec Decimator to clear.
+ */
+void AdcDecimatorReset(AdcDecimator *dec)
+{
+    uint16_t i;
+
+    dec->phase = 0;
+    for (i = 0; i < ADC_DECIM_ORDER; i++)
+    {
+        dec->integrator[i] = 0;
+        dec->comb[i] = 0;
+    }
+    for (i = 0; i < ADC_DECIM_FIR_TAPS - 1U; i++)
+        dec->history[i] = 0;
+}
+
+/**
+ * @brief Decimates a block of codes of one channel.
+ *
+ * @param dec Decimator to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives the output codes, Q(ADC_DECIM_FRAC_BITS).
+ * @param maxOut Size of out.
+ * @return Number of outputs produced.
+ */
+size_t AdcDecimatorProcess(AdcDecimator *dec, const uint16_t *in, size_t n, size_t stride,
+                           int32_t *out, size_t maxOut)
+{
+    size_t produced = 0;
+    int32_t centre = (int32_t)dec->centre;
+
+    while (n > 0U)
+    {
+        size_t len = dec->ratio - dec->phase;
+        size_t i;
+        int32_t y;
+
+        if (len > n)
+            len = n;
+
+        // Integrators: the only per-input work
+        if (dec->wide)
+        {
+            uint64_t i0 = dec->integrator[0];
+            uint64_t i1 = dec->integrator[1];
+            uint64_t i2 = dec->integrator[2];
+
+            for (i = 0; i < len; i++)
+            {
+                i0 += (uint64_t)(int64_t)((int32_t)in[i * stride] - centre);
+                i1 += i0;
+                i2 += i1;
+            }
+            dec->integrator[0] = i0;
+            dec->integrator[1] = i1;
+            dec->integrator[2] = i2;
+        }
+        else
+        {
+            uint32_t i0 = (uint32_t)dec->integrator[0];
+            uint32_t i1 = (uint32_t)dec->integrator[1];
+            uint32_t i2 = (uint32_t)dec->integrator[2];
+
+            for (i = 0; i < len; i++)
+            {
+                i0 += (uint32_t)((int32_t)in[i * stride] - centre);
+                i1 += i0;
+                i2 += i1;
+            }
+            dec->integrator[0] = i0;
+            dec->integrator[1] = i1;
+            dec->integrator[2] = i2;
+        }
+
+        in += len * stride;
+        n -= len;
+        dec->phase += len;
+
+        if (dec->phase < dec->ratio)
+            break;
+        dec->phase = 0;
+
+        y = AdcDecimatorOutput(dec, dec->wide ? dec->integrator[2] :
+                                               (uint64_t)(uint32_t)dec->integrator[2]);
+        if (produced < maxOut)
+            out[produced] = y;
+        produced++;
+    }
+
+    return produced;
+}
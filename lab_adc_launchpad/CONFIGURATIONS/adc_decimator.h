@@ -0,0 +1,109 @@
+/**
+ * @file adc_decimator.h
+ * @brief Header file for the CIC + compensation-FIR decimation stage.
+ *
+ * This file contains definitions and function declarations for decimating a
+ * raw code stream with a CIC filter and a droop-compensation FIR.
+ *
+ * @date Created on: Jun 08, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_DECIMATOR_H_
+#define ADC_DECIMATOR_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief CIC order (integrator/comb pairs), differential delay 1.
+ */
+#define ADC_DECIM_ORDER         3U
+
+/**
+ * @brief Supported decimation ratios.
+ */
+#define ADC_DECIM_MIN_RATIO     8U
+#define ADC_DECIM_MAX_RATIO     1024U
+
+/**
+ * @brief Fractional bits of the output codes (output = code * 2^8).
+ */
+#define ADC_DECIM_FRAC_BITS     8U
+
+/**
+ * @brief Compensation FIR length and coefficient format (Q20).
+ */
+#define ADC_DECIM_FIR_TAPS      3U
+#define ADC_DECIM_COEFF_SHIFT   20U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Decimator of one channel.
+ *
+ * CIC registers use modular arithmetic: 32-bit when the input bits plus the
+ * CIC growth (ORDER * log2(ratio)) fit, 64-bit otherwise.
+ */
+typedef struct
+{
+    uint16_t ratio;                         //!< Decimation ratio R
+    uint16_t phase;                         //!< Inputs since the last output
+    uint16_t centre;                        //!< Code subtracted at the input (mid-scale)
+    uint16_t shift;                         //!< CIC output shift to ADC_DECIM_FRAC_BITS
+    bool wide;                              //!< 64-bit CIC registers
+    uint64_t integrator[ADC_DECIM_ORDER];   //!< Integrator states (input rate)
+    uint64_t comb[ADC_DECIM_ORDER];         //!< Comb delays (output rate)
+    int32_t coeff[ADC_DECIM_FIR_TAPS];      //!< Compensation FIR, Q20, gain-corrected
+    int32_t history[ADC_DECIM_FIR_TAPS - 1U];   //!< FIR delay line
+    uint32_t outputs;                       //!< Outputs produced
+} AdcDecimator;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Sets the ratio and input resolution of a decimator and clears it.
+ *
+ * @param dec Decimator to initialize.
+ * @param ratio Decimation ratio (ADC_DECIM_MIN_RATIO to ADC_DECIM_MAX_RATIO).
+ * @param inputBits Resolution of the input codes (12 or 16).
+ * @return false if a parameter is out of range.
+ */
+bool AdcDecimatorInit(AdcDecimator *dec, uint16_t ratio, uint16_t inputBits);
+
+/**
+ * @brief Clears the CIC and FIR states, keeping the ratio (e.g. after lost samples).
+ *
+ * @param dec Decimator to clear.
+ */
+void AdcDecimatorReset(AdcDecimator *dec);
+
+/**
+ * @brief Decimates a block of codes of one channel.
+ *
+ * Outputs beyond maxOut are computed (the filter state stays consistent) but
+ * not stored; at most n / ratio + 1 outputs are produced.
+ *
+ * @param dec Decimator to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives the output codes, Q(ADC_DECIM_FRAC_BITS).
+ * @param maxOut Size of out.
+ * @return Number of outputs produced.
+ */
+size_t AdcDecimatorProcess(AdcDecimator *dec, const uint16_t *in, size_t n, size_t stride,
+                           int32_t *out, size_t maxOut);
+
+#endif /* ADC_DECIMATOR_H_ */
@@ -0,0 +1,179 @@
+/**
+ * @file adc_dma.c
+ * @brief DMA ping-pong capture engine from ADC result registers into GS RAM.
+ *
+ * This file moves ADC results into memory without CPU involvement. Every
+ * ADCA interrupt 1 pulse triggers one DMA burst that reads ADCARESULT0 and
+ * ADCBRESULT0, so a block holds interleaved AdcSample entries. The channel
+ * runs in continuous mode and alternates between two blocks in GS RAM.
+ *
+ * Ping-pong scheme: the channel interrupt is generated at the beginning of
+ * each transfer, after the shadow destination has been copied into the active
+ * register. The ISR then points the shadow register at the other block for
+ * the next transfer and reports the block that the previous transfer filled.
+ *
+ * @date Created on: Feb 09, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_dma.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+#if (NUM_ADC_CHANNELS != 2)
+#error "adc_dma.c: the DMA burst reads exactly one ADCA and one ADCB result"
+#endif
+
+/**
+ * @brief Word distance from the ADCA to the ADCB SOC0 result register.
+ */
+#define ADC_DMA_RESULT_STEP     ((int16_t)(myADCB_RESULT_BASE - myADCA_RESULT_BASE))
+
+/**
+ * @brief Wrap size larger than any transfer, i.e. wrapping disabled.
+ */
+#define ADC_DMA_NO_WRAP         0x10000UL
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Ping-pong blocks in GS RAM (section adcdmabuf -> RAMGS2)
+#pragma DATA_SECTION(adcDmaBuffer, "adcdmabuf")
+static AdcSample adcDmaBuffer[2][ADC_DMA_BLOCK_SAMPLES];
+
+static AdcDmaBlockCallback dmaCallback = NULL;
+static volatile uint32_t dmaTransferCount = 0;  // Transfers started since start
+static volatile uint32_t dmaOverflows = 0;      // DMA trigger overflows
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Configures the DMA channel for ping-pong capture.
+ *
+ * Burst (one trigger): ADCARESULT0 -> ADCBRESULT0, i.e. one AdcSample.
+ * Transfer (one block): ADC_DMA_BLOCK_SAMPLES bursts. The source steps back
+ * to ADCARESULT0 after each burst; the destination keeps incrementing.
+ *
+ * @param callback Function to call for each finished block (may be NULL).
+ */
+void AdcDmaCaptureInit(AdcDmaBlockCallback callback)
+{
+    dmaCallback = callback;
+
+    //
+    // ADC: the DMA consumes ADCINT1, so the CPU ISR is not used and the
+    // flag is never cleared; continuous mode keeps the pulses coming
+    //
+    Interrupt_disable(INT_ADCA1);
+    ADC_enableContinuousMode(myADCA_BASE, ADC_INT_NUMBER1);
+    ADC_clearInterruptStatus(myADCA_BASE, ADC_INT_NUMBER1);
+    ADC_clearInterruptOverflowStatus(myADCA_BASE, ADC_INT_NUMBER1);
+
+    //
+    // DMA channel
+    //
+    DMA_initController();
+    DMA_setEmulationMode(DMA_EMULATION_FREE_RUN);
+
+    DMA_configAddresses(ADC_DMA_CH_BASE, &adcDmaBuffer[0][0],
+                        (const void *)(myADCA_RESULT_BASE + (uint32_t)myADCA_SOC0));
+    DMA_configBurst(ADC_DMA_CH_BASE, NUM_ADC_CHANNELS, ADC_DMA_RESULT_STEP, 1);
+    DMA_configTransfer(ADC_DMA_CH_BASE, ADC_DMA_BLOCK_SAMPLES,
+                       -ADC_DMA_RESULT_STEP, 1);
+    DMA_configWrap(ADC_DMA_CH_BASE, ADC_DMA_NO_WRAP, 0, ADC_DMA_NO_WRAP, 0);
+    DMA_configMode(ADC_DMA_CH_BASE, DMA_TRIGGER_ADCA1,
+                   DMA_CFG_ONESHOT_DISABLE | DMA_CFG_CONTINUOUS_ENABLE |
+                   DMA_CFG_SIZE_16BIT);
+
+    DMA_setInterruptMode(ADC_DMA_CH_BASE, DMA_INT_AT_BEGINNING);
+    DMA_enableInterrupt(ADC_DMA_CH_BASE);
+    DMA_enableTrigger(ADC_DMA_CH_BASE);
+
+    //
+    // Interrupt: one per started transfer
+    //
+    Interrupt_register(ADC_DMA_CH_INT, &AdcDmaCaptureISR);
+    Interrupt_enable(ADC_DMA_CH_INT);
+}
+
+/**
+ * @brief Arms the DMA channel and starts the ePWM sample clock.
+ */
+void AdcDmaCaptureStart(void)
+{
+    dmaTransferCount = 0;
+    dmaOverflows = 0;
+
+    // First transfer fills block 0
+    DMA_configAddresses(ADC_DMA_CH_BASE, &adcDmaBuffer[0][0],
+                        (const void *)(myADCA_RESULT_BASE + (uint32_t)myADCA_SOC0));
+    DMA_clearTriggerFlag(ADC_DMA_CH_BASE);
+    DMA_clearErrorFlag(ADC_DMA_CH_BASE);
+    ADC_clearInterruptStatus(myADCA_BASE, ADC_INT_NUMBER1);
+    DMA_startChannel(ADC_DMA_CH_BASE);
+
+    AdcAcquisitionStart();
+}
+
+/**
+ * @brief Stops the ePWM sample clock and the DMA channel.
+ */
+void AdcDmaCaptureStop(void)
+{
+    AdcAcquisitionStop();
+    DMA_stopChannel(ADC_DMA_CH_BASE);
+}
+
+/**
+ * @brief Returns the number of blocks completed since AdcDmaCaptureStart().
+ */
+uint32_t AdcDmaGetBlockCount(void)
+{
+    uint32_t count = dmaTransferCount;
+    return (count > 0U) ? (count - 1U) : 0U;
+}
+
+/**
+ * @brief Returns the number of DMA trigger overflows (lost samples).
+ */
+uint32_t AdcDmaGetOverflows(void)
+{
+    return dmaOverflows;
+}
+
+/**
+ * @brief DMA channel ISR: swaps the ping-pong buffers and raises the callback.
+ *
+ * Runs at the beginning of transfer k, which fills block (k & 1). The shadow
+ * destination is pointed at block ((k + 1) & 1) for transfer k + 1, and
+ * block ((k - 1) & 1), completed by transfer k - 1, is handed to the callback.
+ */
+__interrupt void AdcDmaCaptureISR(void)
+{
+    uint32_t transfer = dmaTransferCount;
+
+    DMA_configDestAddress(ADC_DMA_CH_BASE,
+                          &adcDmaBuffer[(uint16_t)(transfer + 1U) & 1U][0]);
+
+    if (DMA_getOverflowFlag(ADC_DMA_CH_BASE))
+    {
+        DMA_clearErrorFlag(ADC_DMA_CH_BASE);
+        dmaOverflows++;
+    }
+
+    dmaTransferCount = transfer + 1U;
+
+    if ((transfer > 0U) && (dmaCallback != NULL))
+    {
+        dmaCallback(&adcDmaBuffer[(uint16_t)(transfer - 1U) & 1U][0],
+                    ADC_DMA_BLOCK_SAMPLES);
+    }
+
+    Interrupt_clearACKGroup(ADC_DMA_CH_ACK_GROUP);
+}
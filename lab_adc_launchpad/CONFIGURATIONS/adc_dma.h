@@ -0,0 +1,101 @@
+/**
+ * @file adc_dma.h
+ * @brief Header file for the DMA ping-pong ADC capture engine.
+ *
+ * This file contains definitions and function declarations for capturing
+ * sustained sample blocks with the DMA. Each ADCA interrupt 1 pulse triggers a
+ * DMA burst that copies the SOC0 results of ADCA and ADCB into one of two
+ * blocks in GS RAM. A callback is raised when a block is complete, so the CPU
+ * only touches finished blocks and never individual samples.
+ *
+ * @date Created on: Feb 09, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_DMA_H_
+#define ADC_DMA_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"              // Include SysConfig generated header
+#include "adc_acquisition.h"    // AdcSample, ePWM sample clock
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief DMA channel used by the capture engine.
+ */
+#define ADC_DMA_CH_BASE             DMA_CH1_BASE
+#define ADC_DMA_CH_INT              INT_DMA_CH1
+#define ADC_DMA_CH_ACK_GROUP        INTERRUPT_ACK_GROUP7
+
+/**
+ * @brief Samples per ping-pong block.
+ *
+ * Both blocks are placed in section adcdmabuf (RAMGS2), so
+ * 2 * ADC_DMA_BLOCK_SAMPLES * NUM_ADC_CHANNELS must fit in 4K words.
+ */
+#define ADC_DMA_BLOCK_SAMPLES       1024U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Called from the DMA ISR each time a block is complete.
+ *
+ * The block stays valid until the following block completes, i.e. for
+ * ADC_DMA_BLOCK_SAMPLES sample periods.
+ *
+ * @param block First sample of the finished block.
+ * @param numSamples Number of samples in the block.
+ */
+typedef void (*AdcDmaBlockCallback)(const AdcSample *block, uint16_t numSamples);
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Configures the DMA channel for ping-pong capture.
+ *
+ * AdcAcquisitionInit() must be called first to set up the ePWM sample clock.
+ * The ADCA1 CPU interrupt is disabled and ADCINT1 is switched to continuous
+ * mode, so the DMA alone consumes every conversion.
+ *
+ * @param callback Function to call for each finished block (may be NULL).
+ */
+void AdcDmaCaptureInit(AdcDmaBlockCallback callback);
+
+/**
+ * @brief Arms the DMA channel and starts the ePWM sample clock.
+ */
+void AdcDmaCaptureStart(void);
+
+/**
+ * @brief Stops the ePWM sample clock and the DMA channel.
+ */
+void AdcDmaCaptureStop(void);
+
+/**
+ * @brief Returns the number of blocks completed since AdcDmaCaptureStart().
+ */
+uint32_t AdcDmaGetBlockCount(void);
+
+/**
+ * @brief Returns the number of DMA trigger overflows (lost samples).
+ */
+uint32_t AdcDmaGetOverflows(void);
+
+/**
+ * @brief DMA channel ISR: swaps the ping-pong buffers and raises the callback.
+ */
+__interrupt void AdcDmaCaptureISR(void);
+
+#endif /* ADC_DMA_H_ */
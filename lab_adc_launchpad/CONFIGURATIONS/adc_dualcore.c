@@ -0,0 +1,146 @@
+/**
+ * @file adc_dualcore.c
+ * @brief CPU1 side of the dual-core pipeline: block handoff to CPU2 over IPC.
+ *
+ * CPU1 boots CPU2, publishes the block configuration in CPU1-to-CPU2 message
+ * RAM and then only forwards the address of every finished DMA block. The
+ * DMA blocks stay in RAMGS2, which CPU1 owns and CPU2 can read, so no sample
+ * is copied between the cores.
+ *
+ * @date Created on: Mar 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_dualcore.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+#if (NUM_ADC_CHANNELS > ADC_IPC_MAX_CHANNELS)
+#error "adc_dualcore.c: more channels than ADC_IPC_MAX_CHANNELS"
+#endif
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Block configuration in CPU1-to-CPU2 message RAM (readable by CPU2)
+#pragma DATA_SECTION(adcIpcConfig, "adcIpcConfig")
+static AdcIpcConfig adcIpcConfig;
+
+static volatile uint32_t dualBlocksSent = 0;
+static volatile uint32_t dualBlocksDropped = 0;
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Boots CPU2, synchronizes with it and sends the block configuration.
+ *
+ * @param sampleRateHz Actual acquisition rate (from AdcAcquisitionInit()).
+ * @return false if CPU2 cannot be booted in this build configuration.
+ */
+bool AdcDualCoreInit(uint32_t sampleRateHz)
+{
+#ifdef _FLASH
+    uint16_t ch;
+
+    adcIpcConfig.numChannels = NUM_ADC_CHANNELS;
+    adcIpcConfig.rsvd = 0;
+    adcIpcConfig.sampleRateHz = sampleRateHz;
+    adcIpcConfig.overrunEpoch = 0;
+    for (ch = 0; ch < ADC_IPC_MAX_CHANNELS; ch++)
+    {
+        adcIpcConfig.midScale[ch] = (ch < NUM_ADC_CHANNELS) ?
+                                    (float)adcChannels[ch].midScale : 0.0f;
+        adcIpcConfig.scale[ch] = (ch < NUM_ADC_CHANNELS) ?
+                                 adcChannels[ch].scale : 0.0f;
+    }
+
+    IPC_init(IPC_CPU1_L_CPU2_R);
+    Device_bootCPU2(C1C2_BROM_BOOTMODE_BOOT_FROM_FLASH);
+
+    // Wait until CPU2 has reached its main loop
+    IPC_sync(IPC_CPU1_L_CPU2_R, ADC_IPC_FLAG_SYNC);
+
+    IPC_sendCommand(IPC_CPU1_L_CPU2_R, ADC_IPC_FLAG_BLOCK,
+                    IPC_ADDR_CORRECTION_DISABLE, ADC_IPC_CMD_CONFIG,
+                    (uint32_t)&adcIpcConfig, 0U);
+    IPC_waitForAck(IPC_CPU1_L_CPU2_R, ADC_IPC_FLAG_BLOCK);
+
+    dualBlocksSent = 0;
+    dualBlocksDropped = 0;
+    return true;
+#else
+    // The CPU2 project (CPU2/) only has a flash configuration, so there is
+    // no CPU2 image to boot from RAM
+    (void)sampleRateHz;
+    return false;
+#endif
+}
+
+/**
+ * @brief DMA block callback: hands a finished block to CPU2.
+ *
+ * @param block First sample of the finished block.
+ * @param numSamples Number of samples in the block.
+ */
+void AdcDualCoreSendBlock(const AdcSample *block, uint16_t numSamples)
+{
+    // IPC_sendCommand() fails while CPU2 has not acknowledged the last block
+    if (IPC_sendCommand(IPC_CPU1_L_CPU2_R, ADC_IPC_FLAG_BLOCK,
+                        IPC_ADDR_CORRECTION_DISABLE, ADC_IPC_CMD_BLOCK,
+                        (uint32_t)block, (uint32_t)numSamples))
+        dualBlocksSent++;
+    else
+    {
+        // The DMA now refills the block CPU2 is still analyzing
+        dualBlocksDropped++;
+        adcIpcConfig.overrunEpoch++;
+    }
+}
+
+/**
+ * @brief Copies the latest CPU2 results, if CPU2 has sent new ones.
+ *
+ * @param results Receives the results.
+ * @return true if new results were copied.
+ */
+bool AdcDualCoreReadResults(AdcIpcResults *results)
+{
+    uint32_t command;
+    uint32_t addr;
+    uint32_t data;
+    bool valid;
+
+    if (!IPC_readCommand(IPC_CPU1_L_CPU2_R, ADC_IPC_FLAG_RESULT,
+                         IPC_ADDR_CORRECTION_DISABLE, &command, &addr, &data))
+        return false;
+
+    // CPU2 does not touch the result block until the flag is acknowledged
+    valid = (command == ADC_IPC_CMD_RESULT);
+    if (valid)
+        *results = *(const AdcIpcResults *)addr;
+
+    IPC_ackFlagRtoL(IPC_CPU1_L_CPU2_R, ADC_IPC_FLAG_RESULT);
+    return valid;
+}
+
+/**
+ * @brief Returns the number of blocks handed to CPU2.
+ */
+uint32_t AdcDualCoreGetBlocksSent(void)
+{
+    return dualBlocksSent;
+}
+
+/**
+ * @brief Returns the number of blocks dropped because CPU2 was still busy.
+ */
+uint32_t AdcDualCoreGetBlocksDropped(void)
+{
+    return dualBlocksDropped;
+}
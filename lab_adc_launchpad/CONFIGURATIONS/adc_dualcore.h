@@ -0,0 +1,74 @@
+/**
+ * @file adc_dualcore.h
+ * @brief Header file for the CPU1 side of the dual-core pipeline.
+ *
+ * This file contains function declarations for handing DMA capture blocks to
+ * CPU2 (see adc_ipc.h for the protocol). CPU1 keeps only the acquisition;
+ * statistics, filtering and spectral analysis run on CPU2, which has the
+ * whole block period (ADC_DMA_BLOCK_SAMPLES sample periods) per block.
+ *
+ * @date Created on: Mar 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_DUALCORE_H_
+#define ADC_DUALCORE_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "adc_config.h"     // adcChannels[]
+#include "adc_dma.h"        // AdcSample, DMA block callback
+#include "adc_ipc.h"        // Shared protocol
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Boots CPU2, synchronizes with it and sends the block configuration.
+ *
+ * Must be called before AdcDmaCaptureStart(). Blocks until CPU2 has read the
+ * configuration. CPU2 boots from its flash image (CPU2/ project), so this
+ * requires the _FLASH build.
+ *
+ * @param sampleRateHz Actual acquisition rate (from AdcAcquisitionInit()).
+ * @return false if CPU2 cannot be booted in this build configuration.
+ */
+bool AdcDualCoreInit(uint32_t sampleRateHz);
+
+/**
+ * @brief DMA block callback: hands a finished block to CPU2.
+ *
+ * Runs in the DMA ISR. If CPU2 has not released the previous block, the
+ * block is counted as dropped instead and the overrun epoch is bumped, so
+ * CPU2 marks its result for the overwritten block as invalid.
+ *
+ * @param block First sample of the finished block.
+ * @param numSamples Number of samples in the block.
+ */
+void AdcDualCoreSendBlock(const AdcSample *block, uint16_t numSamples);
+
+/**
+ * @brief Copies the latest CPU2 results, if CPU2 has sent new ones.
+ *
+ * @param results Receives the results.
+ * @return true if new results were copied.
+ */
+bool AdcDualCoreReadResults(AdcIpcResults *results);
+
+/**
+ * @brief Returns the number of blocks handed to CPU2.
+ */
+uint32_t AdcDualCoreGetBlocksSent(void);
+
+/**
+ * @brief Returns the number of blocks dropped because CPU2 was still busy.
+ */
+uint32_t AdcDualCoreGetBlocksDropped(void);
+
+#endif /* ADC_DUALCORE_H_ */
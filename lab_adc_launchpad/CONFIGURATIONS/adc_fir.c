@@ -0,0 +1,280 @@
+/**
+ * @file adc_fir.c
+ * @brief Block-processing polyphase FIR filter engine.
+ *
+ * Delay line: every sample is written twice, at pos and pos + branchTaps, so
+ * the last branchTaps samples are always contiguous from delay[pos] (newest
+ * first) and the dot product needs no modulo.
+ *
+ * Decimation by D: y[m] = sum h[k] x[mD - k]; all inputs enter the delay
+ * line but the dot product runs once per D inputs.
+ * Interpolation by L: y[nL + p] = sum_k h[kL + p] x[n - k]; each input is
+ * followed by one dot product per branch p over branchTaps = ceil(taps / L)
+ * taps (branches padded with zeros).
+ *
+ * @date Created on: Jun 15, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_fir.h"
+#include <math.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+#define ADC_FIR_PI              3.14159265358979f
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Coefficients in fast RAM, delay lines in GS RAM
+#pragma DATA_SECTION(firCoeffPool, "adcfircoef")
+static float firCoeffPool[ADC_FIR_COEFF_POOL];
+#pragma DATA_SECTION(firDelayPool, "adcfirdelay")
+static float firDelayPool[ADC_FIR_DELAY_POOL];
+
+static uint16_t firCoeffUsed = 0;   // Floats allocated from firCoeffPool
+static uint16_t firDelayUsed = 0;   // Floats allocated from firDelayPool
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Dot product of len coefficients with len delay-line samples.
+ *
+ * FPU32: two accumulators cover the 2-cycle MPYF32/ADDF32 latency, so the
+ * loop issues one MAC per cycle pair without stalls. Host: four accumulators
+ * let the compiler vectorize.
+ */
+static inline float AdcFirDot(const float *c, const float *x, uint16_t len)
+{
+    uint16_t i = 0;
+
+#if defined(__TMS320C28XX_FPU32__)
+    float acc0 = 0.0f;
+    float acc1 = 0.0f;
+
+    for (; i + 1U < len; i += 2U)
+    {
+        acc0 += c[i] * x[i];
+        acc1 += c[i + 1U] * x[i + 1U];
+    }
+    if (i < len)
+        acc0 += c[i] * x[i];
+
+    return acc0 + acc1;
+#else
+    float acc0 = 0.0f;
+    float acc1 = 0.0f;
+    float acc2 = 0.0f;
+    float acc3 = 0.0f;
+
+    for (; i + 3U < len; i += 4U)
+    {
+        acc0 += c[i] * x[i];
+        acc1 += c[i + 1U] * x[i + 1U];
+        acc2 += c[i + 2U] * x[i + 2U];
+        acc3 += c[i + 3U] * x[i + 3U];
+    }
+    for (; i < len; i++)
+        acc0 += c[i] * x[i];
+
+    return (acc0 + acc1) + (acc2 + acc3);
+#endif
+}
+
+/**
+ * @brief Pushes one sample into the delay line (newest at delay[pos]).
+ */
+static inline void AdcFirPush(AdcFir *fir, float x)
+{
+    uint16_t pos = (fir->pos == 0U) ? (fir->branchTaps - 1U) : (fir->pos - 1U);
+
+    fir->delay[pos] = x;
+    fir->delay[pos + fir->branchTaps] = x;
+    fir->pos = pos;
+}
+
+/**
+ * @brief Pushes one sample and produces the outputs it completes.
+ */
+static inline size_t AdcFirStep(AdcFir *fir, float x, float *out)
+{
+    const float *d;
+    uint16_t p;
+
+    AdcFirPush(fir, x);
+    d = &fir->delay[fir->pos];
+
+    if (fir->interpolation > 1U)
+    {
+        for (p = 0; p < fir->interpolation; p++)
+            out[p] = AdcFirDot(&fir->coeff[p * fir->branchTaps], d, fir->branchTaps);
+        return fir->interpolation;
+    }
+
+    if (++fir->phase < fir->decimation)
+        return 0;
+    fir->phase = 0;
+    out[0] = AdcFirDot(fir->coeff, d, fir->branchTaps);
+
+    return 1;
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Releases both pools (filters created before become invalid).
+ */
+void AdcFirPoolReset(void)
+{
+    firCoeffUsed = 0;
+    firDelayUsed = 0;
+}
+
+/**
+ * @brief Designs a windowed-sinc (Hamming) low-pass prototype.
+ *
+ * @param coeff Receives the taps.
+ * @param taps Filter length.
+ * @param cutoff Cut-off frequency as a fraction of the sample rate (0 to 0.5).
+ * @param gain DC gain (e.g. L for an interpolator).
+ */
+void AdcFirDesignLowpass(float *coeff, uint16_t taps, float cutoff, float gain)
+{
+    float centre = 0.5f * (float)(taps - 1U);
+    float sum = 0.0f;
+    uint16_t k;
+
+    for (k = 0; k < taps; k++)
+    {
+        float t = (float)k - centre;
+        float h = (t == 0.0f) ? (2.0f * cutoff) :
+                  (sinf(2.0f * ADC_FIR_PI * cutoff * t) / (ADC_FIR_PI * t));
+        float w = (taps > 1U) ?
+                  (0.54f - 0.46f * cosf(2.0f * ADC_FIR_PI * (float)k / (float)(taps - 1U))) : 1.0f;
+
+        coeff[k] = h * w;
+        sum += coeff[k];
+    }
+
+    for (k = 0; k < taps; k++)
+        coeff[k] *= gain / sum;
+}
+
+/**
+ * @brief Creates a filter: copies its coefficients into the fast RAM pool and
+ * allocates its delay line.
+ *
+ * @param fir Filter to create.
+ * @param coeff Prototype taps h[0..taps-1].
+ * @param taps Prototype filter length.
+ * @param decimation D (1 for none).
+ * @param interpolation L (1 for none); D and L cannot both exceed 1.
+ * @return false if a parameter is invalid or a pool is exhausted.
+ */
+bool AdcFirCreate(AdcFir *fir, const float *coeff, uint16_t taps, uint16_t decimation,
+                  uint16_t interpolation)
+{
+    uint16_t branchTaps;
+    uint16_t p;
+    uint16_t k;
+    float *c;
+
+    if ((taps == 0U) || (decimation == 0U) || (interpolation == 0U) ||
+        ((decimation > 1U) && (interpolation > 1U)))
+        return false;
+
+    branchTaps = (taps + interpolation - 1U) / interpolation;
+    if (((uint32_t)firCoeffUsed + (uint32_t)branchTaps * interpolation > ADC_FIR_COEFF_POOL) ||
+        ((uint32_t)firDelayUsed + 2U * (uint32_t)branchTaps > ADC_FIR_DELAY_POOL))
+        return false;
+
+    // Polyphase decomposition, zero-padded branches
+    c = &firCoeffPool[firCoeffUsed];
+    for (p = 0; p < interpolation; p++)
+    {
+        for (k = 0; k < branchTaps; k++)
+        {
+            uint16_t j = k * interpolation + p;
+            c[p * branchTaps + k] = (j < taps) ? coeff[j] : 0.0f;
+        }
+    }
+    firCoeffUsed += branchTaps * interpolation;
+
+    fir->coeff = c;
+    fir->delay = &firDelayPool[firDelayUsed];
+    firDelayUsed += 2U * branchTaps;
+
+    fir->taps = taps;
+    fir->branchTaps = branchTaps;
+    fir->decimation = decimation;
+    fir->interpolation = interpolation;
+    AdcFirReset(fir);
+
+    return true;
+}
+
+/**
+ * @brief Clears the delay line and the decimation phase.
+ *
+ * @param fir Filter to clear.
+ */
+void AdcFirReset(AdcFir *fir)
+{
+    uint16_t k;
+
+    for (k = 0; k < 2U * fir->branchTaps; k++)
+        fir->delay[k] = 0.0f;
+
+    fir->pos = 0;
+    fir->phase = 0;
+}
+
+/**
+ * @brief Filters a block of floats.
+ *
+ * @param fir Filter to run.
+ * @param in Input samples.
+ * @param n Number of input samples.
+ * @param out Receives the outputs.
+ * @return Number of outputs.
+ */
+size_t AdcFirProcess(AdcFir *fir, const float *in, size_t n, float *out)
+{
+    size_t produced = 0;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        produced += AdcFirStep(fir, in[i], &out[produced]);
+
+    return produced;
+}
+
+/**
+ * @brief Filters a block of raw codes of one channel (output in codes).
+ *
+ * @param fir Filter to run.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives the outputs.
+ * @return Number of outputs.
+ */
+size_t AdcFirProcessCodes(AdcFir *fir, const uint16_t *in, size_t n, size_t stride,
+                          float *out)
+{
+    size_t produced = 0;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        produced += AdcFirStep(fir, (float)in[i * stride], &out[produced]);
+
+    return produced;
+}
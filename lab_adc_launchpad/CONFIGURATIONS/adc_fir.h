@@ -0,0 +1,128 @@
+/**
+ * @file adc_fir.h
+ * @brief Header file for the block-processing polyphase FIR filter engine.
+ *
+ * This file contains definitions and function declarations for float FIR
+ * filters with a per-channel circular delay line, processing whole blocks
+ * (DMA-sized buffers) per call. A filter can decimate by D (only every Dth
+ * output is computed: taps / D MACs per input) or interpolate by L (the taps
+ * are split into L polyphase branches: taps MACs per input in total).
+ * Coefficients are copied into a pool in fast RAM (section adcfircoef ->
+ * RAMD1) and delay lines into a pool in GS RAM (section adcfirdelay ->
+ * RAMGS13). The inner dot product has an FPU32 variant for the C28x and a
+ * host variant, selected at compile time from the same source.
+ *
+ * @date Created on: Jun 15, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_FIR_H_
+#define ADC_FIR_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Coefficients in the fast RAM pool (floats, RAMD1 = 2K words).
+ */
+#define ADC_FIR_COEFF_POOL      1024U
+
+/**
+ * @brief Delay line words in the GS RAM pool (floats, RAMGS13 = 4K words).
+ *
+ * A filter with T taps per branch takes 2 * T floats (double-length line).
+ */
+#define ADC_FIR_DELAY_POOL      2048U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief FIR filter of one channel.
+ */
+typedef struct
+{
+    const float *coeff;     //!< Branch-major coefficients: coeff[p * branchTaps + k] = h[k L + p]
+    float *delay;           //!< Double-length delay line, newest sample at delay[pos]
+    uint16_t taps;          //!< Prototype filter length
+    uint16_t branchTaps;    //!< Taps per polyphase branch (= taps when L = 1)
+    uint16_t decimation;    //!< D: one output per D inputs
+    uint16_t interpolation; //!< L: L outputs per input
+    uint16_t pos;           //!< Newest sample in the delay line
+    uint16_t phase;         //!< Inputs since the last output (decimation)
+} AdcFir;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Releases both pools (filters created before become invalid).
+ */
+void AdcFirPoolReset(void);
+
+/**
+ * @brief Designs a windowed-sinc (Hamming) low-pass prototype.
+ *
+ * @param coeff Receives the taps.
+ * @param taps Filter length.
+ * @param cutoff Cut-off frequency as a fraction of the sample rate (0 to 0.5).
+ * @param gain DC gain (e.g. L for an interpolator).
+ */
+void AdcFirDesignLowpass(float *coeff, uint16_t taps, float cutoff, float gain);
+
+/**
+ * @brief Creates a filter: copies its coefficients into the fast RAM pool and
+ * allocates its delay line.
+ *
+ * @param fir Filter to create.
+ * @param coeff Prototype taps h[0..taps-1].
+ * @param taps Prototype filter length.
+ * @param decimation D (1 for none).
+ * @param interpolation L (1 for none); D and L cannot both exceed 1.
+ * @return false if a parameter is invalid or a pool is exhausted.
+ */
+bool AdcFirCreate(AdcFir *fir, const float *coeff, uint16_t taps, uint16_t decimation,
+                  uint16_t interpolation);
+
+/**
+ * @brief Clears the delay line and the decimation phase.
+ *
+ * @param fir Filter to clear.
+ */
+void AdcFirReset(AdcFir *fir);
+
+/**
+ * @brief Filters a block of floats.
+ *
+ * @param fir Filter to run.
+ * @param in Input samples.
+ * @param n Number of input samples.
+ * @param out Receives the outputs: up to n / D + 1 (decimation) or n * L
+ *            (interpolation).
+ * @return Number of outputs.
+ */
+size_t AdcFirProcess(AdcFir *fir, const float *in, size_t n, float *out);
+
+/**
+ * @brief Filters a block of raw codes of one channel (output in codes).
+ *
+ * @param fir Filter to run.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives the outputs, as for AdcFirProcess().
+ * @return Number of outputs.
+ */
+size_t AdcFirProcessCodes(AdcFir *fir, const uint16_t *in, size_t n, size_t stride,
+                          float *out);
+
+#endif /* ADC_FIR_H_ */
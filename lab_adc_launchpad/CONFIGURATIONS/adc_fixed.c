@@ -0,0 +1,174 @@
+/**
+ * @file adc_fixed.c
+ * @brief Fixed-point (Q-format) conversion and statistics path.
+ *
+ * The float path converts every code with a float multiply and keeps float
+ * statistics. Here each calibrated slope (volts per code) is split into a
+ * Q15 mantissa m in [0.5, 1) and a power of two, slope = m * 2^-(15 + e), so
+ * a 16-bit code times m fits in 32 bits and one shift gives Q24 volts; the
+ * intercept (volts at code 0, -midScale * scale when uncalibrated) is added
+ * in Q24:
+ *
+ *   volts(Q24) = ((raw * m) >> (15 + e - 24)) + intercept(Q24)
+ *
+ * DIFFERENTIAL (5.035e-5 V) gives m = 27034, shift 5; SINGLE_ENDED
+ * (8.057e-4 V) gives m = 27034, shift 1. The mantissa is rounded to 15 bits,
+ * a relative scale error below 2e-5 (0.03 LSB at 16-bit full scale). A
+ * calibration gain within ADC_CAL_MAX_GAIN_ERROR keeps the same shift.
+ *
+ * @date Created on: Mar 30, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_fixed.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Largest product shift; keeps (raw - midScale) * mantissa >> shift >= 1 LSB.
+ */
+#define ADC_FIXED_MAX_SHIFT     30U
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+static AdcFixedScale fixedScale[NUM_ADC_CHANNELS];
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Derives the Q15 scale mantissa and shift of every channel.
+ *
+ * Must be called after AdcCalInit() and again after a calibration changes.
+ * The calibrated slope is normalized into [0.5, 1) by powers of two; the number
+ * of doublings e gives the shift 15 + e - 24 from the product to Q24.
+ *
+ * @return false if a channel scale cannot be represented (shift out of range).
+ */
+bool AdcFixedInit(void)
+{
+    uint16_t ch;
+    bool valid = true;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        float m = AdcCalGetSlope(ch);
+        int16_t e = 0;
+        int16_t shift;
+        int32_t mantissa;
+
+        while ((m < 0.5f) && (e < 64))
+        {
+            m *= 2.0f;
+            e++;
+        }
+        while (m >= 1.0f)
+        {
+            m *= 0.5f;
+            e--;
+        }
+
+        mantissa = (int32_t)(m * (float)(1UL << ADC_FIXED_SCALE_Q) + 0.5f);
+        if (mantissa >= (int32_t)(1UL << ADC_FIXED_SCALE_Q))
+        {
+            // Rounded up to 1.0: renormalize
+            mantissa >>= 1;
+            e--;
+        }
+
+        shift = (int16_t)ADC_FIXED_SCALE_Q + e - (int16_t)ADC_FIXED_VOLTS_Q;
+        if ((shift < 0) || (shift > (int16_t)ADC_FIXED_MAX_SHIFT))
+        {
+            shift = 0;
+            valid = false;
+        }
+
+        fixedScale[ch].intercept = (int32_t)(AdcCalGetIntercept(ch) *
+                                             (float)(1UL << ADC_FIXED_VOLTS_Q));
+        fixedScale[ch].mantissa = mantissa;
+        fixedScale[ch].shift = (uint16_t)shift;
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Converts raw ADC results to Q24 voltages (integer only).
+ *
+ * raw <= 65535 and mantissa < 2^15, so the product fits in a signed
+ * 32-bit integer.
+ *
+ * @param voltageQ24 Array to store the Q24 voltages (minimum size: NUM_ADC_CHANNELS).
+ * @param read Array containing raw ADC results (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcFixedResult(int32_t voltageQ24[], const uint16_t read[])
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcFixedScale *s = &fixedScale[ch];
+        voltageQ24[ch] = (((int32_t)read[ch] * s->mantissa) >> s->shift) + s->intercept;
+    }
+}
+
+/**
+ * @brief Clears the statistics.
+ *
+ * @param stats Statistics to reset.
+ */
+void AdcFixedStatsReset(AdcFixedStats *stats)
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        stats->min[ch] = INT32_MAX;
+        stats->max[ch] = INT32_MIN;
+        stats->sum[ch] = 0;
+    }
+    stats->count = 0;
+}
+
+/**
+ * @brief Adds one sample of Q24 voltages to the statistics.
+ *
+ * @param stats Statistics to update.
+ * @param voltageQ24 Q24 voltages of all channels.
+ */
+void AdcFixedStatsUpdate(AdcFixedStats *stats, const int32_t voltageQ24[])
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        int32_t v = voltageQ24[ch];
+
+        if (v < stats->min[ch])
+            stats->min[ch] = v;
+        if (v > stats->max[ch])
+            stats->max[ch] = v;
+        stats->sum[ch] += v;
+    }
+    stats->count++;
+}
+
+/**
+ * @brief Returns the mean of one channel in Q24 volts (0 if empty).
+ *
+ * @param stats Statistics to read.
+ * @param ch Channel index.
+ */
+int32_t AdcFixedStatsMean(const AdcFixedStats *stats, uint16_t ch)
+{
+    if (stats->count == 0U)
+        return 0;
+
+    return (int32_t)(stats->sum[ch] / (int64_t)stats->count);
+}
@@ -0,0 +1,122 @@
+/**
+ * @file adc_fixed.h
+ * @brief Header file for the fixed-point (Q-format) conversion and statistics path.
+ *
+ * This file contains definitions and function declarations for converting
+ * raw ADC codes to voltages and accumulating statistics with integer
+ * arithmetic only. Voltages are Q24 (volts * 2^24) and the per-channel scale
+ * is a Q15 mantissa with a shift, derived from the calibrated slope and
+ * intercept (adc_calibration.h, ideal DIFFERENTIAL/SINGLE_ENDED scale when
+ * uncalibrated). Float conversion is left to display time.
+ *
+ * @date Created on: Mar 30, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_FIXED_H_
+#define ADC_FIXED_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_config.h"     // adcChannels[], NUM_ADC_CHANNELS
+#include "adc_calibration.h"    // Calibrated slope and intercept
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Fractional bits of a fixed-point voltage (Q24: +/-128 V range).
+ */
+#define ADC_FIXED_VOLTS_Q       24U
+
+/**
+ * @brief Fractional bits of the scale mantissa (Q15, 0.5 <= mantissa < 1).
+ */
+#define ADC_FIXED_SCALE_Q       15U
+
+/**
+ * @brief Volts per Q24 LSB, for display-time conversion.
+ */
+#define ADC_FIXED_Q24_TO_VOLTS  (1.0f / 16777216.0f)
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Integer scale of one channel: volts(Q24) = ((raw * mantissa) >> shift) + intercept.
+ */
+typedef struct
+{
+    int32_t intercept;      //!< Volts at code 0, Q24
+    int32_t mantissa;       //!< Q15 scale mantissa (16384..32767)
+    uint16_t shift;         //!< Right shift of the product to Q24
+} AdcFixedScale;
+
+/**
+ * @brief Integer running statistics of all channels (Q24 volts).
+ */
+typedef struct
+{
+    int32_t min[NUM_ADC_CHANNELS];      //!< Smallest voltage
+    int32_t max[NUM_ADC_CHANNELS];      //!< Largest voltage
+    int64_t sum[NUM_ADC_CHANNELS];      //!< Sum of voltages
+    uint32_t count;                     //!< Samples accumulated
+} AdcFixedStats;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Derives the Q15 scale mantissa and shift of every channel.
+ *
+ * Must be called after AdcCalInit() and again after a calibration changes.
+ *
+ * @return false if a channel scale cannot be represented (shift out of range).
+ */
+bool AdcFixedInit(void);
+
+/**
+ * @brief Converts raw ADC results to Q24 voltages (integer only).
+ *
+ * @param voltageQ24 Array to store the Q24 voltages (minimum size: NUM_ADC_CHANNELS).
+ * @param read Array containing raw ADC results (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcFixedResult(int32_t voltageQ24[], const uint16_t read[]);
+
+/**
+ * @brief Clears the statistics.
+ *
+ * @param stats Statistics to reset.
+ */
+void AdcFixedStatsReset(AdcFixedStats *stats);
+
+/**
+ * @brief Adds one sample of Q24 voltages to the statistics.
+ *
+ * @param stats Statistics to update.
+ * @param voltageQ24 Q24 voltages of all channels.
+ */
+void AdcFixedStatsUpdate(AdcFixedStats *stats, const int32_t voltageQ24[]);
+
+/**
+ * @brief Returns the mean of one channel in Q24 volts (0 if empty).
+ *
+ * @param stats Statistics to read.
+ * @param ch Channel index.
+ */
+int32_t AdcFixedStatsMean(const AdcFixedStats *stats, uint16_t ch);
+
+/**
+ * @brief Converts a Q24 voltage to float volts (display time only).
+ */
+static inline float AdcFixedToVolts(int32_t voltageQ24)
+{
+    return (float)voltageQ24 * ADC_FIXED_Q24_TO_VOLTS;
+}
+
+#endif /* ADC_FIXED_H_ */
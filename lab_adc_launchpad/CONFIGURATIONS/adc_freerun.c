@@ -0,0 +1,200 @@
+/**
+ * @file adc_freerun.c
+ * @brief Free-running (continuous-conversion) ADC capture with overflow accounting.
+ *
+ * SysConfig disables continuous mode and leaves the SOC interrupt trigger at
+ * NONE, so every conversion needs a software or ePWM trigger. Here ADCINT1 is
+ * sourced from the channel's SOC and the same SOC is re-triggered by ADCINT1,
+ * which chains conversions back-to-back at the converter's maximum rate.
+ *
+ * Overflow accounting: in continuous mode ADCINT1 pulses on every end of
+ * conversion, even while the flag is still set. If the flag has not been
+ * cleared by then, the hardware sets the ADCINT1 overflow bit, i.e. a result
+ * was overwritten before it was read.
+ *
+ * @date Created on: Mar 09, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_freerun.h"
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Capture block in GS RAM (section ramgs1 -> RAMGS1)
+#pragma DATA_SECTION(adcFreeRunBlock, "ramgs1")
+static AdcSample adcFreeRunBlock[ADC_FREERUN_BLOCK_SAMPLES];
+
+static uint32_t freeRunLost[NUM_ADC_CHANNELS];     // Overflows since init
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Configures every channel's SOC to re-trigger itself from ADCINT1.
+ *
+ * @return false if two channels share a converter (one ADCINT1 per converter).
+ */
+bool AdcFreeRunInit(void)
+{
+    uint16_t ch;
+    uint16_t other;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        for (other = 0; other < ch; other++)
+        {
+            if (adcChannels[other].base == adcChannels[ch].base)
+                return false;
+        }
+    }
+
+    Interrupt_disable(INT_ADCA1);
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcChannelDescriptor *desc = &adcChannels[ch];
+
+        // No external trigger: the SOC is started by ADCINT1 only
+        ADC_setupSOC(desc->base, desc->soc, ADC_TRIGGER_SW_ONLY,
+                     desc->channel, ADC_SAMPLE_WINDOW);
+
+        ADC_setInterruptSource(desc->base, ADC_INT_NUMBER1, desc->soc);
+        ADC_enableContinuousMode(desc->base, ADC_INT_NUMBER1);
+        ADC_enableInterrupt(desc->base, ADC_INT_NUMBER1);
+        ADC_clearInterruptStatus(desc->base, ADC_INT_NUMBER1);
+        ADC_clearInterruptOverflowStatus(desc->base, ADC_INT_NUMBER1);
+
+        freeRunLost[ch] = 0;
+    }
+
+    CycleCounterInit();
+    return true;
+}
+
+/**
+ * @brief Starts the converters by forcing the first SOC of each chain.
+ */
+void AdcFreeRunStart(void)
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        ADC_setInterruptSOCTrigger(adcChannels[ch].base, adcChannels[ch].soc,
+                                   ADC_INT_SOC_TRIGGER_ADCINT1);
+    }
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        ADC_forceSOC(adcChannels[ch].base, adcChannels[ch].soc);
+}
+
+/**
+ * @brief Breaks the ADCINT1 -> SOC loop; converters stop after the current conversion.
+ */
+void AdcFreeRunStop(void)
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        ADC_setInterruptSOCTrigger(adcChannels[ch].base, adcChannels[ch].soc,
+                                   ADC_INT_SOC_TRIGGER_NONE);
+        ADC_disableContinuousMode(adcChannels[ch].base, ADC_INT_NUMBER1);
+    }
+}
+
+/**
+ * @brief Captures one block of ADC_FREERUN_BLOCK_SAMPLES samples per channel.
+ *
+ * Converters run at different rates (16-bit vs 12-bit), so each channel fills
+ * its column of the block independently; the loop ends when all are full.
+ *
+ * @param info Receives the block timing and loss counts (may be NULL).
+ * @return Captured block; valid until the next call.
+ */
+const AdcSample *AdcFreeRunCaptureBlock(AdcFreeRunBlockInfo *info)
+{
+    uint16_t count[NUM_ADC_CHANNELS];
+    uint32_t first[NUM_ADC_CHANNELS];
+    uint32_t last[NUM_ADC_CHANNELS];
+    uint32_t lost[NUM_ADC_CHANNELS];
+    uint16_t remaining = NUM_ADC_CHANNELS;
+    uint16_t ch;
+
+    // Conversions between blocks are not captured, so they are not losses
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        ADC_clearInterruptStatus(adcChannels[ch].base, ADC_INT_NUMBER1);
+        ADC_clearInterruptOverflowStatus(adcChannels[ch].base, ADC_INT_NUMBER1);
+        count[ch] = 0;
+        first[ch] = 0;
+        last[ch] = 0;
+        lost[ch] = 0;
+    }
+
+    while (remaining > 0U)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        {
+            const AdcChannelDescriptor *desc = &adcChannels[ch];
+            uint16_t n = count[ch];
+
+            if ((n == ADC_FREERUN_BLOCK_SAMPLES) ||
+                (ADC_getInterruptStatus(desc->base, ADC_INT_NUMBER1) == false))
+                continue;
+
+            adcFreeRunBlock[n].raw[ch] = ADC_readResult(desc->resultBase, desc->soc);
+
+            // Another end of conversion while the flag was set: result lost
+            if (ADC_getInterruptOverflowStatus(desc->base, ADC_INT_NUMBER1))
+            {
+                ADC_clearInterruptOverflowStatus(desc->base, ADC_INT_NUMBER1);
+                lost[ch]++;
+            }
+            ADC_clearInterruptStatus(desc->base, ADC_INT_NUMBER1);
+
+            if (n == 0U)
+                first[ch] = CycleCounterRead();
+            n++;
+            if (n == ADC_FREERUN_BLOCK_SAMPLES)
+            {
+                last[ch] = CycleCounterRead();
+                remaining--;
+            }
+            count[ch] = n;
+        }
+    }
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        freeRunLost[ch] += lost[ch];
+
+        if (info != NULL)
+        {
+            uint32_t cycles = last[ch] - first[ch];
+
+            info->cycles[ch] = cycles;
+            info->lost[ch] = lost[ch];
+            info->rateHz[ch] = (cycles > 0U) ?
+                (uint32_t)((float)(ADC_FREERUN_BLOCK_SAMPLES - 1U) *
+                           (float)CYCLE_COUNTER_FREQ / (float)cycles) : 0U;
+        }
+    }
+
+    return adcFreeRunBlock;
+}
+
+/**
+ * @brief Returns the conversions lost on a channel's converter since AdcFreeRunInit().
+ *
+ * @param channel Channel index in adcChannels[].
+ */
+uint32_t AdcFreeRunGetLost(uint16_t channel)
+{
+    return (channel < NUM_ADC_CHANNELS) ? freeRunLost[channel] : 0U;
+}
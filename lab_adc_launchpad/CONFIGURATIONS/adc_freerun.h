@@ -0,0 +1,103 @@
+/**
+ * @file adc_freerun.h
+ * @brief Header file for free-running (continuous-conversion) ADC capture.
+ *
+ * This file contains definitions and function declarations for running every
+ * converter back-to-back at its maximum rate. The end of each conversion
+ * raises ADCINT1, and ADCINT1 re-triggers the same SOC, so no CPU or ePWM
+ * trigger is involved. Blocks are captured by polling, and every ADCINT1
+ * overflow (a result overwritten before it was read) is counted per converter.
+ *
+ * @date Created on: Mar 09, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_FREERUN_H_
+#define ADC_FREERUN_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"              // Include SysConfig generated header
+#include "adc_config.h"         // adcChannels[]
+#include "adc_acquisition.h"    // AdcSample
+#include "cycle_counter.h"      // Block timing
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Samples per channel in one captured block.
+ *
+ * The block is placed in section ramgs1 (RAMGS1), so
+ * ADC_FREERUN_BLOCK_SAMPLES * NUM_ADC_CHANNELS must fit in 4K words.
+ */
+#define ADC_FREERUN_BLOCK_SAMPLES   1024U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Timing and loss report of one captured block.
+ */
+typedef struct
+{
+    uint32_t cycles[NUM_ADC_CHANNELS];  //!< SYSCLK cycles, first to last sample
+    uint32_t rateHz[NUM_ADC_CHANNELS];  //!< Measured conversion rate
+    uint32_t lost[NUM_ADC_CHANNELS];    //!< Overflow events during the block
+} AdcFreeRunBlockInfo;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Configures every channel's SOC to re-trigger itself from ADCINT1.
+ *
+ * Uses ADC_setInterruptSOCTrigger(ADCINT1) and ADC_enableContinuousMode(), so
+ * each end of conversion starts the next one. The ADCA1 CPU interrupt is
+ * disabled; results are collected by AdcFreeRunCaptureBlock().
+ *
+ * @return false if two channels share a converter (one ADCINT1 per converter).
+ */
+bool AdcFreeRunInit(void);
+
+/**
+ * @brief Starts the converters by forcing the first SOC of each chain.
+ */
+void AdcFreeRunStart(void);
+
+/**
+ * @brief Breaks the ADCINT1 -> SOC loop; converters stop after the current conversion.
+ */
+void AdcFreeRunStop(void);
+
+/**
+ * @brief Captures one block of ADC_FREERUN_BLOCK_SAMPLES samples per channel.
+ *
+ * The interrupt and overflow flags are cleared when the block starts, so only
+ * conversions lost while the block was being captured are counted.
+ * Each channel fills its own column at its converter's rate, so the rows of
+ * the block are not time-aligned across channels.
+ *
+ * @param info Receives the block timing and loss counts (may be NULL).
+ * @return Captured block; valid until the next call.
+ */
+const AdcSample *AdcFreeRunCaptureBlock(AdcFreeRunBlockInfo *info);
+
+/**
+ * @brief Returns the conversions lost on a channel's converter since AdcFreeRunInit().
+ *
+ * Each ADCINT1 overflow event means at least one result was overwritten
+ * before it was read, so a zero count proves that no sample was dropped.
+ *
+ * @param channel Channel index in adcChannels[].
+ */
+uint32_t AdcFreeRunGetLost(uint16_t channel);
+
+#endif /* ADC_FREERUN_H_ */
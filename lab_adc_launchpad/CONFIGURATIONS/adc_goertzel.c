@@ -0,0 +1,218 @@
+/**
+ * @file adc_goertzel.c
+ * @brief Goertzel tone-tracking bank.
+ *
+ * This file contains the Goertzel recurrence and the per-block magnitude and
+ * phase, referred to the first sample of the block.
+ *
+ * @date Created on: Jun 01, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_goertzel.h"
+#include <math.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+#define ADC_GOERTZEL_PI         3.14159265358979f
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Forms the results of the finished block and starts the next one.
+ */
+static void AdcGoertzelFinishBlock(AdcGoertzelBank *bank)
+{
+    float scale = 2.0f / (float)bank->blockLength;
+    uint16_t k;
+
+    for (k = 0; k < bank->numTones; k++)
+    {
+        AdcGoertzelTone *t = &bank->tone[k];
+        AdcGoertzelResult *r = &bank->result[k];
+
+        // y = s1 - exp(-jw) s2, then X = exp(-jw (N-1)) y
+        float yr = t->s1 - t->cosW * t->s2;
+        float yi = t->sinW * t->s2;
+        float xr = yr * t->rotCos + yi * t->rotSin;
+        float xi = yi * t->rotCos - yr * t->rotSin;
+
+        r->amplitude = scale * sqrtf(xr * xr + xi * xi);
+        r->phaseDeg = atan2f(xi, xr) * (180.0f / ADC_GOERTZEL_PI);
+
+        t->s1 = 0.0f;
+        t->s2 = 0.0f;
+    }
+
+    bank->offset = (float)bank->sum / (float)bank->blockLength;
+    bank->sum = 0;
+    bank->count = 0;
+    bank->blocks++;
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Sets the tones and block length of a bank and clears it.
+ *
+ * @param bank Bank to initialize.
+ * @param frequencyHz Tone frequencies (below sampleRateHz / 2).
+ * @param numTones Number of tones (1 to ADC_GOERTZEL_MAX_TONES).
+ * @param sampleRateHz Sample rate of the channel.
+ * @param blockLength Samples per block (2 to ADC_GOERTZEL_MAX_BLOCK).
+ * @return false if a parameter is out of range.
+ */
+bool AdcGoertzelInit(AdcGoertzelBank *bank, const float frequencyHz[], uint16_t numTones,
+                     float sampleRateHz, uint32_t blockLength)
+{
+    uint16_t k;
+
+    if ((numTones == 0U) || (numTones > ADC_GOERTZEL_MAX_TONES) || (sampleRateHz <= 0.0f) ||
+        (blockLength < 2U) || (blockLength > ADC_GOERTZEL_MAX_BLOCK))
+        return false;
+
+    for (k = 0; k < numTones; k++)
+    {
+        AdcGoertzelTone *t = &bank->tone[k];
+        float cycles = frequencyHz[k] / sampleRateHz;
+        float w = 2.0f * ADC_GOERTZEL_PI * cycles;
+        float rot;
+
+        if ((frequencyHz[k] < 0.0f) || (cycles >= 0.5f))
+            return false;
+
+        // Rotation over the block, reduced to one turn first for accuracy
+        rot = cycles * (float)(blockLength - 1U);
+        rot = 2.0f * ADC_GOERTZEL_PI * (rot - floorf(rot));
+
+        t->cosW = cosf(w);
+        t->sinW = sinf(w);
+        t->coeff = 2.0f * t->cosW;
+        t->rotCos = cosf(rot);
+        t->rotSin = sinf(rot);
+        t->s1 = 0.0f;
+        t->s2 = 0.0f;
+
+        bank->result[k].frequencyHz = frequencyHz[k];
+        bank->result[k].amplitude = 0.0f;
+        bank->result[k].phaseDeg = 0.0f;
+    }
+
+    bank->numTones = numTones;
+    bank->blockLength = blockLength;
+    bank->count = 0;
+    bank->sum = 0;
+    bank->offset = -1.0f;   // Set from the first code
+    bank->blocks = 0;
+
+    return true;
+}
+
+/**
+ * @brief Discards the current block and the results, keeping the tones.
+ *
+ * @param bank Bank to clear.
+ */
+void AdcGoertzelClear(AdcGoertzelBank *bank)
+{
+    uint16_t k;
+
+    for (k = 0; k < bank->numTones; k++)
+    {
+        bank->tone[k].s1 = 0.0f;
+        bank->tone[k].s2 = 0.0f;
+        bank->result[k].amplitude = 0.0f;
+        bank->result[k].phaseDeg = 0.0f;
+    }
+
+    bank->count = 0;
+    bank->sum = 0;
+    bank->blocks = 0;
+}
+
+/**
+ * @brief Feeds one code.
+ *
+ * @param bank Bank to update.
+ * @param code Raw code.
+ * @return true if the code completed a block (new results).
+ */
+bool AdcGoertzelUpdate(AdcGoertzelBank *bank, uint16_t code)
+{
+    return AdcGoertzelUpdateBlock(bank, &code, 1U, 1U);
+}
+
+/**
+ * @brief Feeds a block of codes of one channel.
+ *
+ * Tone-outer loops over the part of the input inside the current block keep
+ * each filter state in registers.
+ *
+ * @param bank Bank to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @return true if at least one block completed (new results).
+ */
+bool AdcGoertzelUpdateBlock(AdcGoertzelBank *bank, const uint16_t *in, size_t n,
+                            size_t stride)
+{
+    bool completed = false;
+
+    if ((n > 0U) && (bank->offset < 0.0f))
+        bank->offset = (float)in[0];
+
+    while (n > 0U)
+    {
+        size_t len = bank->blockLength - bank->count;
+        float offset = bank->offset;
+        uint32_t sum = 0;
+        uint16_t k;
+        size_t i;
+
+        if (len > n)
+            len = n;
+
+        for (i = 0; i < len; i++)
+            sum += in[i * stride];
+
+        for (k = 0; k < bank->numTones; k++)
+        {
+            AdcGoertzelTone *t = &bank->tone[k];
+            float coeff = t->coeff;
+            float s1 = t->s1;
+            float s2 = t->s2;
+
+            for (i = 0; i < len; i++)
+            {
+                float s0 = ((float)in[i * stride] - offset) + coeff * s1 - s2;
+                s2 = s1;
+                s1 = s0;
+            }
+
+            t->s1 = s1;
+            t->s2 = s2;
+        }
+
+        bank->sum += sum;
+        bank->count += len;
+        in += len * stride;
+        n -= len;
+
+        if (bank->count == bank->blockLength)
+        {
+            AdcGoertzelFinishBlock(bank);
+            completed = true;
+        }
+    }
+
+    return completed;
+}
@@ -0,0 +1,132 @@
+/**
+ * @file adc_goertzel.h
+ * @brief Header file for the Goertzel tone-tracking bank.
+ *
+ * This file contains definitions and function declarations for tracking the
+ * amplitude and phase of a few tones per channel.
+ *
+ * @date Created on: Jun 01, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_GOERTZEL_H_
+#define ADC_GOERTZEL_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Largest number of tones per bank.
+ */
+#define ADC_GOERTZEL_MAX_TONES      8U
+
+/**
+ * @brief Longest block (the code sum of a block must fit in 32 bits).
+ */
+#define ADC_GOERTZEL_MAX_BLOCK      65536UL
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Goertzel state and constants of one tone.
+ */
+typedef struct
+{
+    float coeff;            //!< 2 cos(w)
+    float s1;               //!< s[n-1]
+    float s2;               //!< s[n-2]
+    float cosW;             //!< cos(w)
+    float sinW;             //!< sin(w)
+    float rotCos;           //!< cos(w (N - 1)): refers the phase to the block start
+    float rotSin;           //!< sin(w (N - 1))
+} AdcGoertzelTone;
+
+/**
+ * @brief Result of one tone over the last complete block.
+ */
+typedef struct
+{
+    float frequencyHz;      //!< Tracked frequency
+    float amplitude;        //!< Peak amplitude in codes
+    float phaseDeg;         //!< Phase of the cosine at the block start, -180 to 180
+} AdcGoertzelResult;
+
+/**
+ * @brief Goertzel bank of one channel.
+ *
+ * The mean of the previous block is subtracted from every code, so the DC
+ * level does not leak into the tones and the float state stays small.
+ */
+typedef struct
+{
+    AdcGoertzelTone tone[ADC_GOERTZEL_MAX_TONES];       //!< Running filters
+    AdcGoertzelResult result[ADC_GOERTZEL_MAX_TONES];   //!< Last complete block
+    uint16_t numTones;      //!< Tones in use
+    uint32_t blockLength;   //!< Samples per block (N)
+    uint32_t count;         //!< Samples in the current block
+    uint32_t sum;           //!< Code sum of the current block
+    float offset;           //!< DC level subtracted from the codes
+    uint32_t blocks;        //!< Blocks completed
+} AdcGoertzelBank;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Sets the tones and block length of a bank and clears it.
+ *
+ * Choosing N as a whole number of periods of every tone (e.g. fs / 5 for
+ * 50 Hz and 60 Hz) keeps the tones from leaking into each other.
+ *
+ * @param bank Bank to initialize.
+ * @param frequencyHz Tone frequencies (below sampleRateHz / 2).
+ * @param numTones Number of tones (1 to ADC_GOERTZEL_MAX_TONES).
+ * @param sampleRateHz Sample rate of the channel.
+ * @param blockLength Samples per block (2 to ADC_GOERTZEL_MAX_BLOCK).
+ * @return false if a parameter is out of range.
+ */
+bool AdcGoertzelInit(AdcGoertzelBank *bank, const float frequencyHz[], uint16_t numTones,
+                     float sampleRateHz, uint32_t blockLength);
+
+/**
+ * @brief Discards the current block and the results, keeping the tones.
+ *
+ * Call after a gap in the input, so no block spans it; the results stay
+ * unavailable (blocks 0) until a complete block follows.
+ *
+ * @param bank Bank to clear.
+ */
+void AdcGoertzelClear(AdcGoertzelBank *bank);
+
+/**
+ * @brief Feeds one code.
+ *
+ * @param bank Bank to update.
+ * @param code Raw code.
+ * @return true if the code completed a block (new results).
+ */
+bool AdcGoertzelUpdate(AdcGoertzelBank *bank, uint16_t code);
+
+/**
+ * @brief Feeds a block of codes of one channel.
+ *
+ * @param bank Bank to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @return true if at least one block completed (new results).
+ */
+bool AdcGoertzelUpdateBlock(AdcGoertzelBank *bank, const uint16_t *in, size_t n,
+                            size_t stride);
+
+#endif /* ADC_GOERTZEL_H_ */
@@ -0,0 +1,289 @@
+/**
+ * @file adc_histogram.c
+ * @brief Per-channel code-density histograms with binary export.
+ *
+ * One increment per sample: the bin index is (code >> shift) - base computed
+ * in 16-bit unsigned arithmetic, so codes on either side of the range wrap to
+ * an index >= numBins and take the single out-of-range branch.
+ *
+ * @date Created on: May 11, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_histogram.h"
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Bin storage pools in GS RAM
+#pragma DATA_SECTION(histPool0, "adchist0")
+static uint32_t histPool0[ADC_HIST_POOL0_BINS];
+#pragma DATA_SECTION(histPool1, "adchist1")
+static uint32_t histPool1[ADC_HIST_POOL1_BINS];
+
+static uint16_t histUsed0 = 0;      // Bins allocated from histPool0
+static uint16_t histUsed1 = 0;      // Bins allocated from histPool1
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Counts one code out of range (below bin 0 or above the last bin).
+ */
+static void AdcHistogramOutOfRange(AdcHistogram *hist, uint16_t code)
+{
+    if ((code >> hist->shift) < hist->base)
+        hist->under++;
+    else
+        hist->over++;
+}
+
+/**
+ * @brief Fletcher-16 state, updated with one byte and passed to the sink.
+ */
+typedef struct
+{
+    uint16_t sum1;
+    uint16_t sum2;
+    AdcHistogramPutByte putByte;
+} AdcHistogramWriter;
+
+static void AdcHistogramWriteByte(AdcHistogramWriter *w, uint16_t byte)
+{
+    byte &= 0xFFU;
+    w->sum1 = (w->sum1 + byte) % 255U;
+    w->sum2 = (w->sum2 + w->sum1) % 255U;
+    w->putByte(byte);
+}
+
+static void AdcHistogramWrite16(AdcHistogramWriter *w, uint16_t value)
+{
+    AdcHistogramWriteByte(w, value);
+    AdcHistogramWriteByte(w, value >> 8);
+}
+
+static void AdcHistogramWrite32(AdcHistogramWriter *w, uint32_t value)
+{
+    AdcHistogramWrite16(w, (uint16_t)value);
+    AdcHistogramWrite16(w, (uint16_t)(value >> 16));
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Releases all bin storage (histograms created before become invalid).
+ */
+void AdcHistogramPoolReset(void)
+{
+    histUsed0 = 0;
+    histUsed1 = 0;
+}
+
+/**
+ * @brief Allocates the bins of a histogram from the GS RAM pools and clears it.
+ *
+ * @param hist Histogram to create.
+ * @param numBins Number of bins (1 to ADC_HIST_POOL0_BINS).
+ * @param base First binned code, shifted (bin 0 holds codes base << shift).
+ * @param shift log2 of the codes per bin (0 for one code per bin).
+ * @return false if the pools are exhausted.
+ */
+bool AdcHistogramCreate(AdcHistogram *hist, uint16_t numBins, uint16_t base,
+                        uint16_t shift)
+{
+    uint16_t room0 = ADC_HIST_POOL0_BINS - histUsed0;
+    uint16_t room1 = ADC_HIST_POOL1_BINS - histUsed1;
+
+    if ((numBins == 0U) || (shift > 15U))
+        return false;
+
+    // Smallest pool that fits
+    if ((numBins <= room1) && ((numBins > room0) || (room1 <= room0)))
+    {
+        hist->counts = &histPool1[histUsed1];
+        histUsed1 += numBins;
+    }
+    else if (numBins <= room0)
+    {
+        hist->counts = &histPool0[histUsed0];
+        histUsed0 += numBins;
+    }
+    else
+    {
+        return false;
+    }
+
+    hist->numBins = numBins;
+    hist->base = base;
+    hist->shift = shift;
+    AdcHistogramClear(hist);
+
+    return true;
+}
+
+/**
+ * @brief Clears the bins and counters, keeping the range.
+ *
+ * @param hist Histogram to clear.
+ */
+void AdcHistogramClear(AdcHistogram *hist)
+{
+    uint16_t i;
+
+    for (i = 0; i < hist->numBins; i++)
+        hist->counts[i] = 0;
+
+    hist->saturated = false;
+    hist->total = 0;
+    hist->under = 0;
+    hist->over = 0;
+}
+
+/**
+ * @brief Moves the binned range so it is centred on a code, and clears it.
+ *
+ * The range is clamped to the codes that exist.
+ *
+ * @param hist Histogram to move.
+ * @param code Code at the centre of the new range.
+ */
+void AdcHistogramCenter(AdcHistogram *hist, uint16_t code)
+{
+    uint32_t lastBase = (0x10000UL >> hist->shift) - hist->numBins;
+    uint16_t half = hist->numBins / 2U;
+    uint16_t bin = code >> hist->shift;
+
+    if (hist->numBins > (0x10000UL >> hist->shift))
+        lastBase = 0;
+
+    hist->base = (bin > half) ? (bin - half) : 0U;
+    if (hist->base > lastBase)
+        hist->base = (uint16_t)lastBase;
+
+    AdcHistogramClear(hist);
+}
+
+/**
+ * @brief Counts one code.
+ *
+ * @param hist Histogram to update.
+ * @param code Raw code.
+ */
+void AdcHistogramUpdate(AdcHistogram *hist, uint16_t code)
+{
+    uint16_t bin = (uint16_t)((code >> hist->shift) - hist->base);
+
+    if (hist->total == UINT32_MAX)
+    {
+        hist->saturated = true;
+        return;
+    }
+
+    hist->total++;
+    if (bin < hist->numBins)
+        hist->counts[bin]++;
+    else
+        AdcHistogramOutOfRange(hist, code);
+}
+
+/**
+ * @brief Counts a block of codes of one channel (one increment per sample).
+ *
+ * @param hist Histogram to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcHistogramUpdateBlock(AdcHistogram *hist, const uint16_t *in, size_t n,
+                             size_t stride)
+{
+    uint32_t *counts = hist->counts;
+    uint16_t numBins = hist->numBins;
+    uint16_t base = hist->base;
+    uint16_t shift = hist->shift;
+    size_t i;
+
+    // Saturation is checked once per block
+    if (hist->total > UINT32_MAX - n)
+    {
+        hist->saturated = true;
+        return;
+    }
+    hist->total += n;
+
+    for (i = 0; i < n; i++)
+    {
+        uint16_t code = in[i * stride];
+        uint16_t bin = (uint16_t)((code >> shift) - base);
+
+        if (bin < numBins)
+            counts[bin]++;
+        else
+            AdcHistogramOutOfRange(hist, code);
+    }
+}
+
+/**
+ * @brief Counts empty bins between the lowest and highest occupied bins.
+ *
+ * @param hist Histogram to scan.
+ * @return Number of empty bins inside the occupied range.
+ */
+uint16_t AdcHistogramMissingCodes(const AdcHistogram *hist)
+{
+    uint16_t first = 0;
+    uint16_t last = hist->numBins;
+    uint16_t missing = 0;
+    uint16_t i;
+
+    while ((first < hist->numBins) && (hist->counts[first] == 0U))
+        first++;
+    while ((last > first) && (hist->counts[last - 1U] == 0U))
+        last--;
+
+    for (i = first; i < last; i++)
+    {
+        if (hist->counts[i] == 0U)
+            missing++;
+    }
+
+    return missing;
+}
+
+/**
+ * @brief Sends the histogram as one binary frame.
+ *
+ * @param hist Histogram to send.
+ * @param channel Channel index written into the frame.
+ * @param putByte Byte sink.
+ */
+void AdcHistogramExport(const AdcHistogram *hist, uint16_t channel,
+                        AdcHistogramPutByte putByte)
+{
+    AdcHistogramWriter w = { 0U, 0U, putByte };
+    uint16_t i;
+
+    AdcHistogramWrite16(&w, ADC_HIST_EXPORT_MAGIC);
+    AdcHistogramWrite16(&w, ADC_HIST_EXPORT_VERSION);
+    AdcHistogramWrite16(&w, channel);
+    AdcHistogramWrite16(&w, hist->numBins);
+    AdcHistogramWrite16(&w, hist->base);
+    AdcHistogramWrite16(&w, hist->shift);
+    AdcHistogramWrite16(&w, hist->saturated ? 1U : 0U);
+    AdcHistogramWrite32(&w, hist->total);
+    AdcHistogramWrite32(&w, hist->under);
+    AdcHistogramWrite32(&w, hist->over);
+
+    for (i = 0; i < hist->numBins; i++)
+        AdcHistogramWrite32(&w, hist->counts[i]);
+
+    // Checksum bytes are not part of the sum
+    putByte(w.sum1);
+    putByte(w.sum2);
+}
@@ -0,0 +1,158 @@
+/**
+ * @file adc_histogram.h
+ * @brief Header file for the per-channel code-density histogram engine.
+ *
+ * This file contains definitions and function declarations for histograms of
+ * raw ADC codes. Each histogram covers numBins consecutive bins starting at
+ * code (base << shift), with 2^shift codes per bin; codes outside that range
+ * are counted as under/over. A 12-bit channel takes all 4096 codes at full
+ * resolution, while a 16-bit channel uses a window of codes around its
+ * operating point (DNL data) or a coarse shift over the whole range (noise
+ * shape). Bin storage is allocated from pools in GS RAM (sections adchist0 ->
+ * RAMGS6_7, adchist1 -> RAMGS8).
+ *
+ * @date Created on: May 11, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_HISTOGRAM_H_
+#define ADC_HISTOGRAM_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Bins in each storage pool (uint32_t counts, two words per bin).
+ *
+ * Pool 0 (8K words) holds one full 12-bit histogram; pool 1 (4K words) holds
+ * the window of a 16-bit channel.
+ */
+#define ADC_HIST_POOL0_BINS     4096U
+#define ADC_HIST_POOL1_BINS     2048U
+
+/**
+ * @brief Binary export frame marker ("AH"), sent first, low byte first.
+ */
+#define ADC_HIST_EXPORT_MAGIC   0x4841U
+
+/**
+ * @brief Binary export format version.
+ */
+#define ADC_HIST_EXPORT_VERSION 1U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Code-density histogram of one channel.
+ */
+typedef struct
+{
+    uint32_t *counts;       //!< Bin counts
+    uint16_t numBins;       //!< Number of bins
+    uint16_t base;          //!< Bin 0 holds codes (base << shift) and up
+    uint16_t shift;         //!< log2 of the codes per bin
+    bool saturated;         //!< total reached 2^32 - 1: counting stopped
+    uint32_t total;         //!< Samples counted (in range + under + over)
+    uint32_t under;         //!< Samples below bin 0
+    uint32_t over;          //!< Samples above the last bin
+} AdcHistogram;
+
+/**
+ * @brief Byte sink for AdcHistogramExport() (e.g. a UART transmit function).
+ *
+ * @param byte Byte to send (0 to 255).
+ */
+typedef void (*AdcHistogramPutByte)(uint16_t byte);
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Releases all bin storage (histograms created before become invalid).
+ */
+void AdcHistogramPoolReset(void);
+
+/**
+ * @brief Allocates the bins of a histogram from the GS RAM pools and clears it.
+ *
+ * The smallest pool with room is used, so small histograms do not block the
+ * large pool.
+ *
+ * @param hist Histogram to create.
+ * @param numBins Number of bins (1 to ADC_HIST_POOL0_BINS).
+ * @param base First binned code, shifted (bin 0 holds codes base << shift).
+ * @param shift log2 of the codes per bin (0 for one code per bin).
+ * @return false if the pools are exhausted.
+ */
+bool AdcHistogramCreate(AdcHistogram *hist, uint16_t numBins, uint16_t base,
+                        uint16_t shift);
+
+/**
+ * @brief Clears the bins and counters, keeping the range.
+ *
+ * @param hist Histogram to clear.
+ */
+void AdcHistogramClear(AdcHistogram *hist);
+
+/**
+ * @brief Moves the binned range so it is centred on a code, and clears it.
+ *
+ * @param hist Histogram to move.
+ * @param code Code at the centre of the new range.
+ */
+void AdcHistogramCenter(AdcHistogram *hist, uint16_t code);
+
+/**
+ * @brief Counts one code.
+ *
+ * @param hist Histogram to update.
+ * @param code Raw code.
+ */
+void AdcHistogramUpdate(AdcHistogram *hist, uint16_t code);
+
+/**
+ * @brief Counts a block of codes of one channel (one increment per sample).
+ *
+ * @param hist Histogram to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcHistogramUpdateBlock(AdcHistogram *hist, const uint16_t *in, size_t n,
+                             size_t stride);
+
+/**
+ * @brief Counts empty bins between the lowest and highest occupied bins.
+ *
+ * With one code per bin and enough samples, these are missing codes.
+ *
+ * @param hist Histogram to scan.
+ * @return Number of empty bins inside the occupied range.
+ */
+uint16_t AdcHistogramMissingCodes(const AdcHistogram *hist);
+
+/**
+ * @brief Sends the histogram as one binary frame.
+ *
+ * Frame (16-bit fields low byte first, 32-bit fields low word first):
+ * magic, version, channel, numBins, base, shift, saturated, total, under,
+ * over, counts[numBins], then a Fletcher-16 checksum of all preceding bytes.
+ *
+ * @param hist Histogram to send.
+ * @param channel Channel index written into the frame.
+ * @param putByte Byte sink.
+ */
+void AdcHistogramExport(const AdcHistogram *hist, uint16_t channel,
+                        AdcHistogramPutByte putByte);
+
+#endif /* ADC_HISTOGRAM_H_ */
@@ -0,0 +1,115 @@
+/**
+ * @file adc_ipc.h
+ * @brief Shared CPU1/CPU2 block-handoff protocol for the dual-core pipeline.
+ *
+ * This file is included by both firmware images. CPU1 acquires sample blocks
+ * (DMA ping-pong in GS RAM, owned by CPU1 and readable by CPU2) and CPU2
+ * analyzes them. Handoff uses IPC flags with IPC_sendCommand() /
+ * IPC_readCommand(); the command address is the block (or result) address,
+ * which is the same on both cores for GS and message RAM.
+ *
+ * Sequence:
+ * 1. Both cores call IPC_sync() on ADC_IPC_FLAG_SYNC.
+ * 2. CPU1 sends ADC_IPC_CMD_CONFIG (addr = AdcIpcConfig in CPU1-to-CPU2 RAM).
+ * 3. Per block, CPU1 sends ADC_IPC_CMD_BLOCK (addr = first word, data =
+ *    samples). CPU2 acknowledges once it no longer reads the block, so a busy
+ *    flag at the next block means CPU2 fell behind and the block is dropped.
+ *    The DMA then refills the block CPU2 is still reading, so CPU1 bumps
+ *    AdcIpcConfig.overrunEpoch and CPU2 marks the result of any block during
+ *    which the epoch changed as invalid.
+ * 4. Per analyzed block, CPU2 sends ADC_IPC_CMD_RESULT (addr = AdcIpcResults
+ *    in CPU2-to-CPU1 RAM) if CPU1 has acknowledged the previous result.
+ *
+ * @date Created on: Mar 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_IPC_H_
+#define ADC_IPC_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief IPC flags used by the protocol.
+ */
+#define ADC_IPC_FLAG_BLOCK      IPC_FLAG1   //!< CPU1 -> CPU2 config and blocks
+#define ADC_IPC_FLAG_RESULT     IPC_FLAG2   //!< CPU2 -> CPU1 results
+#define ADC_IPC_FLAG_SYNC       IPC_FLAG31  //!< Start-up handshake
+
+/**
+ * @brief Command values.
+ */
+#define ADC_IPC_CMD_CONFIG      0x0001UL
+#define ADC_IPC_CMD_BLOCK       0x0002UL
+#define ADC_IPC_CMD_RESULT      0x0003UL
+
+/**
+ * @brief Largest number of interleaved channels in a block.
+ */
+#define ADC_IPC_MAX_CHANNELS    4U
+
+/**
+ * @brief Largest number of tones tracked per channel on CPU2.
+ */
+#define ADC_IPC_MAX_TONES       2U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Block layout and conversion constants, sent once by CPU1.
+ *
+ * A block is numSamples rows of numChannels interleaved raw codes;
+ * voltage = (code - midScale) * scale. Stays in CPU1-to-CPU2 RAM after the
+ * handshake, since CPU1 keeps updating overrunEpoch.
+ */
+typedef struct
+{
+    uint16_t numChannels;                       //!< Channels per row
+    uint16_t rsvd;                              //!< Alignment
+    uint32_t sampleRateHz;                      //!< Row rate
+    float midScale[ADC_IPC_MAX_CHANNELS];       //!< Code subtracted before scaling
+    float scale[ADC_IPC_MAX_CHANNELS];          //!< Volts per code
+    uint32_t overrunEpoch;                      //!< Bumped by CPU1 on every dropped block
+} AdcIpcConfig;
+
+/**
+ * @brief Analysis of one channel over one block.
+ */
+typedef struct
+{
+    float mean;             //!< Average voltage
+    float min;              //!< Minimum voltage
+    float max;              //!< Maximum voltage
+    float rmsAc;            //!< RMS of the AC part (standard deviation)
+    float filtered;         //!< Low-pass filter output at the end of the block
+    float frequencyHz;      //!< Dominant frequency from mean crossings
+    float toneAmplitude[ADC_IPC_MAX_TONES];     //!< Peak amplitude of each tone in volts
+    float tonePhaseDeg[ADC_IPC_MAX_TONES];      //!< Phase of each tone, -180 to 180
+} AdcIpcChannelResult;
+
+/**
+ * @brief Analysis results of one block, sent by CPU2.
+ */
+typedef struct
+{
+    uint32_t sequence;          //!< Blocks analyzed since start-up
+    uint32_t numSamples;        //!< Rows in the analyzed block
+    uint32_t cycles;            //!< CPU2 SYSCLK cycles spent on the block
+    uint32_t overwritten;       //!< Blocks overwritten by the DMA during analysis
+    uint16_t valid;             //!< 0 if this block was overwritten during analysis
+    uint16_t tonesValid;        //!< 0 until a Goertzel block completes without a gap
+    float toneHz[ADC_IPC_MAX_TONES];    //!< Tracked tones (0 if tone tracking is off)
+    AdcIpcChannelResult channel[ADC_IPC_MAX_CHANNELS];
+} AdcIpcResults;
+
+#endif /* ADC_IPC_H_ */
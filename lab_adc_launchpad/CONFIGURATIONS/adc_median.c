@@ -0,0 +1,268 @@
+/**
+ * @file adc_median.c
+ * @brief Streaming median and Hampel spike-rejection filter on raw codes.
+ *
+ * This file contains the sorted-window update and the MAD read from the
+ * sorted window for Hampel spike rejection.
+ *
+ * @date Created on: Jul 06, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_median.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief MAD to standard deviation for Gaussian noise.
+ */
+#define ADC_MEDIAN_MAD_TO_SIGMA     1.4826f
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Index of the first sorted entry not below code (lower bound).
+ */
+static inline uint16_t AdcMedianLowerBound(const uint16_t *sorted, uint16_t width,
+                                           uint16_t code)
+{
+    uint16_t lo = 0;
+    uint16_t hi = width;
+
+    while (lo < hi)
+    {
+        uint16_t mid = (lo + hi) >> 1;
+
+        if (sorted[mid] < code)
+            lo = mid + 1U;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+/**
+ * @brief Replaces the oldest code with the new one in both copies.
+ */
+static void AdcMedianSlide(AdcMedian *med, uint16_t code)
+{
+    uint16_t *s = med->sorted;
+    uint16_t old = med->ring[med->pos];
+    uint16_t i;
+
+    med->ring[med->pos] = code;
+    med->pos = (med->pos + 1U == med->width) ? 0U : (med->pos + 1U);
+
+    if (code == old)
+        return;
+
+    i = AdcMedianLowerBound(s, med->width, old);
+    if (code > old)
+    {
+        // Shift the entries in (old, code) down, insert at the end of the gap
+        while ((i + 1U < med->width) && (s[i + 1U] < code))
+        {
+            s[i] = s[i + 1U];
+            i++;
+        }
+    }
+    else
+    {
+        // Shift the entries in (code, old) up, insert at the start of the gap
+        while ((i > 0U) && (s[i - 1U] > code))
+        {
+            s[i] = s[i - 1U];
+            i--;
+        }
+    }
+    s[i] = code;
+}
+
+/**
+ * @brief Median absolute deviation of the sorted window from its median.
+ */
+static uint16_t AdcMedianMad(const AdcMedian *med)
+{
+    const uint16_t *s = med->sorted;
+    uint16_t half = med->width >> 1;
+    uint16_t m = s[half];
+    int16_t lo = (int16_t)half - 1;
+    uint16_t hi = half + 1U;
+    uint16_t dev = 0;
+    uint16_t k;
+
+    // Deviation 0 of the median itself is the first; take half more
+    for (k = 0; k < half; k++)
+    {
+        uint16_t dLo = (lo >= 0) ? (m - s[lo]) : 0xFFFFU;
+        uint16_t dHi = (hi < med->width) ? (s[hi] - m) : 0xFFFFU;
+
+        if (dLo <= dHi)
+        {
+            dev = dLo;
+            lo--;
+        }
+        else
+        {
+            dev = dHi;
+            hi++;
+        }
+    }
+
+    return dev;
+}
+
+/**
+ * @brief Output of the current window (mode dependent).
+ */
+static inline uint16_t AdcMedianOutput(AdcMedian *med)
+{
+    uint16_t half = med->width >> 1;
+    uint16_t median = med->sorted[half];
+    uint16_t centre;
+    uint16_t dev;
+    uint16_t mad;
+
+    if (med->mode == ADC_MEDIAN_MODE_MEDIAN)
+        return median;
+
+    // Centre sample: half positions older than the newest
+    centre = med->pos + half;
+    if (centre >= med->width)
+        centre -= med->width;
+    centre = med->ring[centre];
+
+    dev = (centre > median) ? (centre - median) : (median - centre);
+    if (dev <= 1U)
+        return centre;
+
+    mad = AdcMedianMad(med);
+    if (mad < 1U)
+        mad = 1U;
+
+    if ((float)dev > med->limitScale * (float)mad)
+    {
+        med->replaced++;
+        return median;
+    }
+
+    return centre;
+}
+
+/**
+ * @brief Fills both copies of the window with the first code.
+ */
+static void AdcMedianPrime(AdcMedian *med, uint16_t code)
+{
+    uint16_t i;
+
+    for (i = 0; i < med->width; i++)
+    {
+        med->ring[i] = code;
+        med->sorted[i] = code;
+    }
+
+    med->pos = 0;
+    med->primed = true;
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Sets up a median or Hampel filter.
+ *
+ * @param med Filter to set up.
+ * @param width Window length W (odd, ADC_MEDIAN_MIN_WIDTH to ADC_MEDIAN_MAX_WIDTH).
+ * @param mode ADC_MEDIAN_MODE_MEDIAN or ADC_MEDIAN_MODE_HAMPEL.
+ * @param threshold Hampel threshold k in standard deviations (e.g. 3).
+ * @return false if the width or the mode is invalid.
+ */
+bool AdcMedianInit(AdcMedian *med, uint16_t width, uint16_t mode, float threshold)
+{
+    if ((width < ADC_MEDIAN_MIN_WIDTH) || (width > ADC_MEDIAN_MAX_WIDTH) ||
+        ((width & 1U) == 0U) ||
+        ((mode != ADC_MEDIAN_MODE_MEDIAN) && (mode != ADC_MEDIAN_MODE_HAMPEL)))
+        return false;
+
+    med->width = width;
+    med->mode = mode;
+    med->limitScale = threshold * ADC_MEDIAN_MAD_TO_SIGMA;
+    AdcMedianClear(med);
+
+    return true;
+}
+
+/**
+ * @brief Empties the window (the next code fills it) and the replacement count.
+ *
+ * @param med Filter to clear.
+ */
+void AdcMedianClear(AdcMedian *med)
+{
+    med->pos = 0;
+    med->primed = false;
+    med->replaced = 0;
+}
+
+/**
+ * @brief Adds one code and returns the filtered code.
+ *
+ * @param med Filter to update.
+ * @param code Raw ADC code.
+ * @return Median (median mode) or centre sample / replacement (Hampel mode).
+ */
+uint16_t AdcMedianUpdate(AdcMedian *med, uint16_t code)
+{
+    if (!med->primed)
+        AdcMedianPrime(med, code);
+    else
+        AdcMedianSlide(med, code);
+
+    return AdcMedianOutput(med);
+}
+
+/**
+ * @brief Filters a block of codes of one channel.
+ *
+ * @param med Filter to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives n filtered codes (contiguous).
+ */
+void AdcMedianUpdateBlock(AdcMedian *med, const uint16_t *in, size_t n, size_t stride,
+                          uint16_t *out)
+{
+    size_t i;
+
+    if (n == 0U)
+        return;
+
+    if (!med->primed)
+        AdcMedianPrime(med, in[0]);
+
+    for (i = 0; i < n; i++)
+    {
+        AdcMedianSlide(med, in[i * stride]);
+        out[i] = AdcMedianOutput(med);
+    }
+}
+
+/**
+ * @brief Returns the median of the current window (0 before the first code).
+ *
+ * @param med Filter to read.
+ */
+uint16_t AdcMedianValue(const AdcMedian *med)
+{
+    return med->primed ? med->sorted[med->width >> 1] : 0U;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file adc_median.h
+ * @brief Header file for the streaming median and Hampel spike-rejection filter.
+ *
+ * This file contains definitions and function declarations for a running
+ * median and Hampel spike rejection over the last W codes.
+ *
+ * @date Created on: Jul 06, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_MEDIAN_H_
+#define ADC_MEDIAN_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Narrowest and widest window (odd widths only).
+ */
+#define ADC_MEDIAN_MIN_WIDTH        3U
+#define ADC_MEDIAN_MAX_WIDTH        31U
+
+/**
+ * @brief Filter modes.
+ */
+#define ADC_MEDIAN_MODE_MEDIAN      0U  //!< Output the window median
+#define ADC_MEDIAN_MODE_HAMPEL      1U  //!< Output the centre sample, outliers replaced
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Running median / Hampel filter of one channel.
+ *
+ * Both modes delay the signal by (width - 1) / 2 samples.
+ */
+typedef struct
+{
+    uint16_t ring[ADC_MEDIAN_MAX_WIDTH];    //!< Window in arrival order
+    uint16_t sorted[ADC_MEDIAN_MAX_WIDTH];  //!< Window in ascending order
+    uint16_t width;         //!< W (odd)
+    uint16_t pos;           //!< Oldest code in ring[], overwritten next
+    uint16_t mode;          //!< ADC_MEDIAN_MODE_x
+    bool primed;            //!< Window filled (with the first code on start)
+    float limitScale;       //!< k * 1.4826: MAD to standard deviation, times k
+    uint32_t replaced;      //!< Samples replaced by the median (Hampel)
+} AdcMedian;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Sets up a median or Hampel filter.
+ *
+ * @param med Filter to set up.
+ * @param width Window length W (odd, ADC_MEDIAN_MIN_WIDTH to ADC_MEDIAN_MAX_WIDTH).
+ * @param mode ADC_MEDIAN_MODE_MEDIAN or ADC_MEDIAN_MODE_HAMPEL.
+ * @param threshold Hampel threshold k in standard deviations (e.g. 3).
+ * @return false if the width or the mode is invalid.
+ */
+bool AdcMedianInit(AdcMedian *med, uint16_t width, uint16_t mode, float threshold);
+
+/**
+ * @brief Empties the window (the next code fills it) and the replacement count.
+ *
+ * @param med Filter to clear.
+ */
+void AdcMedianClear(AdcMedian *med);
+
+/**
+ * @brief Adds one code and returns the filtered code.
+ *
+ * @param med Filter to update.
+ * @param code Raw ADC code.
+ * @return Median (median mode) or centre sample / replacement (Hampel mode).
+ */
+uint16_t AdcMedianUpdate(AdcMedian *med, uint16_t code);
+
+/**
+ * @brief Filters a block of codes of one channel.
+ *
+ * @param med Filter to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @param out Receives n filtered codes (contiguous).
+ */
+void AdcMedianUpdateBlock(AdcMedian *med, const uint16_t *in, size_t n, size_t stride,
+                          uint16_t *out);
+
+/**
+ * @brief Returns the median of the current window (0 before the first code).
+ *
+ * @param med Filter to read.
+ */
+uint16_t AdcMedianValue(const AdcMedian *med);
+
+#endif /* ADC_MEDIAN_H_ */
@@ -0,0 +1,203 @@
+/**
+ * @file adc_oversample.c
+ * @brief Hardware oversampling by chaining multiple SOCs on the same channel.
+ *
+ * SysConfig enables only one SOC per channel, so every reading is a single
+ * conversion and noise is averaged afterwards in floats. Here the N SOCs
+ * starting at the channel's SOC (adcChannels[].soc) all sample the same input
+ * from one trigger; the converter sequences them back-to-back and the CPU
+ * only sums N result registers once per trigger.
+ *
+ * @date Created on: Feb 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_oversample.h"
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Indexed like adcChannels[]; set by AdcOversampleInit()/AdcOversampleDisable()
+static uint16_t ovsCount[NUM_ADC_CHANNELS];     // SOCs per trigger
+static uint16_t ovsShift[NUM_ADC_CHANNELS];     // Sum right shift
+static uint16_t ovsExtra[NUM_ADC_CHANNELS];     // Extra output bits
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Maps a chain of SOCs, starting at each channel's SOC, to its channel.
+ *
+ * @param config Settings per channel (array of NUM_ADC_CHANNELS entries).
+ * @param trigger Trigger source for all SOCs.
+ * @return false (nothing changed) if two channels share a converter or a
+ *         chain would run past SOC15.
+ */
+bool AdcOversampleInit(const AdcOversampleConfig config[], ADC_Trigger trigger)
+{
+    uint16_t ch;
+    uint16_t other;
+    uint16_t i;
+    uint16_t log2[NUM_ADC_CHANNELS];
+    uint16_t extra;
+
+    // One chain per converter, and every chain must fit in SOC0..SOC15
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        for (other = 0; other < ch; other++)
+        {
+            if (adcChannels[other].base == adcChannels[ch].base)
+                return false;
+        }
+
+        log2[ch] = config[ch].ratioLog2;
+        if (log2[ch] > ADC_OVS_MAX_LOG2)
+            log2[ch] = ADC_OVS_MAX_LOG2;
+        if (((uint16_t)adcChannels[ch].soc + (1U << log2[ch])) > ADC_OVS_MAX_RATIO)
+            return false;
+    }
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcChannelDescriptor *desc = &adcChannels[ch];
+
+        extra = config[ch].extraBits;
+        if (extra > log2[ch])
+            extra = log2[ch];
+
+        ovsCount[ch] = 1U << log2[ch];
+        ovsShift[ch] = log2[ch] - extra;
+        ovsExtra[ch] = extra;
+
+        // Same channel, same trigger on every SOC of the chain
+        for (i = 0; i < ovsCount[ch]; i++)
+        {
+            ADC_setupSOC(desc->base, (ADC_SOCNumber)(desc->soc + i), trigger,
+                         desc->channel, ADC_SAMPLE_WINDOW);
+        }
+
+        // End of chain raises ADCINT1
+        ADC_setInterruptSource(desc->base, ADC_INT_NUMBER1,
+                               (ADC_SOCNumber)(desc->soc + ovsCount[ch] - 1U));
+        ADC_clearInterruptStatus(desc->base, ADC_INT_NUMBER1);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Restores single-SOC operation (channel SOC only, ADCINT1 on it).
+ */
+void AdcOversampleDisable(void)
+{
+    uint16_t ch;
+    uint16_t i;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcChannelDescriptor *desc = &adcChannels[ch];
+
+        // Chained SOCs back to software-only so a shared trigger skips them
+        for (i = 1; i < ovsCount[ch]; i++)
+        {
+            ADC_setupSOC(desc->base, (ADC_SOCNumber)(desc->soc + i),
+                         ADC_TRIGGER_SW_ONLY, desc->channel,
+                         ADC_SAMPLE_WINDOW);
+        }
+
+        ADC_setInterruptSource(desc->base, ADC_INT_NUMBER1, desc->soc);
+        ADC_clearInterruptStatus(desc->base, ADC_INT_NUMBER1);
+
+        ovsCount[ch] = 1U;
+        ovsShift[ch] = 0U;
+        ovsExtra[ch] = 0U;
+    }
+}
+
+/**
+ * @brief Forces all chained SOCs and returns the oversampled codes.
+ *
+ * @param code Array to store the oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcOversampleConvert(uint32_t code[])
+{
+    uint16_t ch;
+
+    // Start every chain before waiting, so the converters run in parallel
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        ADC_clearInterruptStatus(adcChannels[ch].base, ADC_INT_NUMBER1);
+        ADC_forceMultipleSOC(adcChannels[ch].base,
+                             (uint16_t)(((1UL << ovsCount[ch]) - 1UL) << adcChannels[ch].soc));
+    }
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        while (ADC_getInterruptStatus(adcChannels[ch].base, ADC_INT_NUMBER1) == false)
+        {
+            // Waiting for the last SOC of the chain
+        }
+    }
+
+    AdcOversampleRead(code);
+}
+
+/**
+ * @brief Sums the chained results after ADCINT1 and returns oversampled codes.
+ *
+ * One pass over the result registers: N adds and one shift per channel.
+ * A 16x sum of 16-bit codes needs 20 bits, so a 32-bit accumulator is used.
+ *
+ * @param code Array to store the oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcOversampleRead(uint32_t code[])
+{
+    uint16_t ch;
+    uint16_t soc;
+    uint32_t sum;
+    const volatile uint16_t *result;
+
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        result = (const volatile uint16_t *)(adcChannels[ch].resultBase +
+                                             ADC_RESULTx_OFFSET_BASE) + adcChannels[ch].soc;
+        sum = 0;
+        for (soc = 0; soc < ovsCount[ch]; soc++)
+            sum += result[soc];
+
+        code[ch] = sum >> ovsShift[ch];
+        ADC_clearInterruptStatus(adcChannels[ch].base, ADC_INT_NUMBER1);
+    }
+}
+
+/**
+ * @brief Converts oversampled codes to voltage values.
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param code Array containing oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcOversampleResult(float voltage[], const uint32_t code[])
+{
+    uint16_t ch;
+
+    // Mid-scale and scale factor both follow the extra output bits
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        int32_t signedValue = (int32_t)code[ch] -
+                              (int32_t)((uint32_t)adcChannels[ch].midScale << ovsExtra[ch]);
+        voltage[ch] = (float)signedValue *
+                      (adcChannels[ch].scale / (float)(1UL << ovsExtra[ch]));
+    }
+}
+
+/**
+ * @brief Returns the extra output bits configured for a channel.
+ */
+uint16_t AdcOversampleGetExtraBits(uint16_t channel)
+{
+    return (channel < NUM_ADC_CHANNELS) ? ovsExtra[channel] : 0U;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file adc_oversample.h
+ * @brief Header file for hardware oversampling with chained SOCs.
+ *
+ * This file contains definitions and function declarations for the
+ * oversampling mode. N SOCs (2 to 16) of a converter are mapped to the same
+ * channel and started together, so one trigger yields N conversions that are
+ * summed in a single pass into an oversampled code.
+ *
+ * @date Created on: Feb 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_OVERSAMPLE_H_
+#define ADC_OVERSAMPLE_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"          // Include SysConfig generated header
+#include "adc_config.h"     // NUM_ADC_CHANNELS, scale factors
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Largest oversampling ratio (one converter has 16 SOCs).
+ */
+#define ADC_OVS_MAX_LOG2        4U
+#define ADC_OVS_MAX_RATIO       (1U << ADC_OVS_MAX_LOG2)
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Oversampling settings of one channel.
+ *
+ * The sum of 2^ratioLog2 conversions is shifted right by
+ * (ratioLog2 - extraBits), so the output code carries extraBits more bits than
+ * the converter. Each extra bit of resolution needs 4x oversampling, so
+ * extraBits should not exceed ratioLog2 / 2 for white noise.
+ */
+typedef struct
+{
+    uint16_t ratioLog2;     //!< log2 of SOCs per trigger (0..4 -> 1x..16x)
+    uint16_t extraBits;     //!< Extra output bits (0..ratioLog2)
+} AdcOversampleConfig;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Maps a chain of SOCs, starting at each channel's SOC, to its channel.
+ *
+ * The chain of channel ch is SOC adcChannels[ch].soc onwards. ADCINT1 of each
+ * converter is moved to the last SOC of its chain, so the interrupt flag
+ * marks the end of the whole oversampled burst. Every channel needs its own
+ * converter, as in AdcFreeRunInit().
+ *
+ * @param config Settings per channel (array of NUM_ADC_CHANNELS entries).
+ * @param trigger Trigger source for all SOCs (ADC_TRIGGER_SW_ONLY for
+ *                AdcOversampleConvert(), or an ePWM SOC for hardware pacing).
+ * @return false (nothing changed) if two channels share a converter or a
+ *         chain would run past SOC15.
+ */
+bool AdcOversampleInit(const AdcOversampleConfig config[], ADC_Trigger trigger);
+
+/**
+ * @brief Restores single-SOC operation (channel SOC only, ADCINT1 on it).
+ */
+void AdcOversampleDisable(void);
+
+/**
+ * @brief Forces all chained SOCs and returns the oversampled codes.
+ *
+ * Both converters are started with ADC_forceMultipleSOC before waiting.
+ *
+ * @param code Array to store the oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcOversampleConvert(uint32_t code[]);
+
+/**
+ * @brief Sums the chained results after ADCINT1 and returns oversampled codes.
+ *
+ * Usable from an ISR when the SOCs are hardware-triggered.
+ *
+ * @param code Array to store the oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcOversampleRead(uint32_t code[]);
+
+/**
+ * @brief Converts oversampled codes to voltage values.
+ *
+ * Same scaling as AdcResult(), with the extra bits of each channel removed.
+ *
+ * @param voltage Array to store the calculated voltage values (minimum size: NUM_ADC_CHANNELS).
+ * @param code Array containing oversampled codes (minimum size: NUM_ADC_CHANNELS).
+ */
+void AdcOversampleResult(float voltage[], const uint32_t code[]);
+
+/**
+ * @brief Returns the extra output bits configured for a channel.
+ */
+uint16_t AdcOversampleGetExtraBits(uint16_t channel);
+
+#endif /* ADC_OVERSAMPLE_H_ */
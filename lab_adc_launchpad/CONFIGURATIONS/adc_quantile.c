@@ -0,0 +1,193 @@
+/**
+ * @file adc_quantile.c
+ * @brief Streaming quantile estimator (P-square algorithm).
+ *
+ * This file contains the P-square marker update: at most three marker moves
+ * per sample, so the cycle count is bounded.
+ *
+ * @date Created on: May 18, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_quantile.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief 1.0 in Q32.
+ */
+#define ADC_QUANTILE_ONE_Q32    4294967296.0f
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Piecewise-parabolic height of marker i moved by d (+1 or -1).
+ */
+static float AdcQuantileParabolic(const AdcQuantile *q, uint16_t i, int32_t d)
+{
+    float nPrev = (float)q->pos[i - 1U];
+    float n = (float)q->pos[i];
+    float nNext = (float)q->pos[i + 1U];
+    float df = (float)d;
+
+    return q->height[i] + df / (nNext - nPrev) *
+           ((n - nPrev + df) * (q->height[i + 1U] - q->height[i]) / (nNext - n) +
+            (nNext - n - df) * (q->height[i] - q->height[i - 1U]) / (n - nPrev));
+}
+
+/**
+ * @brief Linear height of marker i moved by d towards its neighbour.
+ */
+static float AdcQuantileLinear(const AdcQuantile *q, uint16_t i, int32_t d)
+{
+    uint16_t j = (d > 0) ? (i + 1U) : (i - 1U);
+
+    return q->height[i] + (float)d * (q->height[j] - q->height[i]) /
+           ((float)q->pos[j] - (float)q->pos[i]);
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Clears an estimator and sets its quantile.
+ *
+ * Desired positions (0-based) start at 0, 2p, 4p, 2+2p, 4 and advance by
+ * 0, p/2, p, (1+p)/2, 1 per sample; the end markers need no tracking.
+ *
+ * @param q Estimator to initialize.
+ * @param p Quantile to estimate, e.g. 0.99f (0 < p < 1).
+ */
+void AdcQuantileInit(AdcQuantile *q, float p)
+{
+    uint16_t i;
+
+    q->p = p;
+    q->count = 0;
+    for (i = 0; i < ADC_QUANTILE_MARKERS; i++)
+    {
+        q->height[i] = 0.0f;
+        q->pos[i] = i;
+    }
+
+    q->increment[0] = (uint32_t)(p * 0.5f * ADC_QUANTILE_ONE_Q32);
+    q->increment[1] = (uint32_t)(p * ADC_QUANTILE_ONE_Q32);
+    q->increment[2] = (uint32_t)((1.0f + p) * 0.5f * ADC_QUANTILE_ONE_Q32);
+    for (i = 0; i < 3U; i++)
+        q->desired[i] = (uint64_t)q->increment[i] * 4U;
+}
+
+/**
+ * @brief Adds one sample.
+ *
+ * @param q Estimator to update.
+ * @param x Sample value.
+ */
+void AdcQuantileUpdate(AdcQuantile *q, float x)
+{
+    uint16_t i;
+    uint16_t k;
+
+    // First five samples: insertion sort into the markers
+    if (q->count < ADC_QUANTILE_MARKERS)
+    {
+        i = (uint16_t)q->count;
+        while ((i > 0U) && (q->height[i - 1U] > x))
+        {
+            q->height[i] = q->height[i - 1U];
+            i--;
+        }
+        q->height[i] = x;
+        q->count++;
+        return;
+    }
+    q->count++;
+
+    // Cell of x; the end markers follow the extremes
+    if (x < q->height[0])
+    {
+        q->height[0] = x;
+        k = 0;
+    }
+    else if (x >= q->height[4])
+    {
+        q->height[4] = x;
+        k = 3;
+    }
+    else
+    {
+        k = 0;
+        while (x >= q->height[k + 1U])
+            k++;
+    }
+
+    for (i = k + 1U; i < ADC_QUANTILE_MARKERS; i++)
+        q->pos[i]++;
+    for (i = 0; i < 3U; i++)
+        q->desired[i] += q->increment[i];
+
+    // Middle markers: move by one rank towards the desired position
+    for (i = 1; i <= 3U; i++)
+    {
+        uint64_t actual = (uint64_t)q->pos[i] << 32;
+        int32_t d = 0;
+
+        if ((q->desired[i - 1U] >= actual + (1ULL << 32)) &&
+            (q->pos[i + 1U] - q->pos[i] > 1U))
+            d = 1;
+        else if ((q->desired[i - 1U] + (1ULL << 32) <= actual) &&
+                 (q->pos[i] - q->pos[i - 1U] > 1U))
+            d = -1;
+
+        if (d != 0)
+        {
+            float h = AdcQuantileParabolic(q, i, d);
+
+            if ((h <= q->height[i - 1U]) || (h >= q->height[i + 1U]))
+                h = AdcQuantileLinear(q, i, d);
+
+            q->height[i] = h;
+            q->pos[i] = (uint32_t)((int32_t)q->pos[i] + d);
+        }
+    }
+}
+
+/**
+ * @brief Adds a block of raw codes of one channel.
+ *
+ * @param q Estimator to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcQuantileUpdateCodes(AdcQuantile *q, const uint16_t *in, size_t n,
+                            size_t stride)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        AdcQuantileUpdate(q, (float)in[i * stride]);
+}
+
+/**
+ * @brief Returns the current quantile estimate (0 if no samples).
+ *
+ * With fewer than five samples, the nearest-rank sample is returned.
+ */
+float AdcQuantileValue(const AdcQuantile *q)
+{
+    if (q->count == 0U)
+        return 0.0f;
+
+    if (q->count < ADC_QUANTILE_MARKERS)
+        return q->height[(uint16_t)(q->p * (float)(q->count - 1U) + 0.5f)];
+
+    return q->height[2];
+}
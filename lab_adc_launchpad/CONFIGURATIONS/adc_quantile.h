@@ -0,0 +1,90 @@
+/**
+ * @file adc_quantile.h
+ * @brief Header file for the streaming quantile estimator (P-square algorithm).
+ *
+ * This file contains definitions and function declarations for estimating
+ * quantiles of a stream (P-square algorithm, Jain and Chlamtac, CACM 1985).
+ *
+ * @date Created on: May 18, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_QUANTILE_H_
+#define ADC_QUANTILE_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Markers per quantile.
+ */
+#define ADC_QUANTILE_MARKERS    5U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief P-square estimator of one quantile.
+ *
+ * Marker positions are integers and the desired positions are kept in Q32,
+ * so the estimator stays exact over runs longer than float can count (2^24).
+ */
+typedef struct
+{
+    float p;                                //!< Quantile (0 < p < 1)
+    uint32_t count;                         //!< Samples seen
+    float height[ADC_QUANTILE_MARKERS];     //!< Marker heights (estimates)
+    uint32_t pos[ADC_QUANTILE_MARKERS];     //!< Marker positions (0-based ranks)
+    uint64_t desired[3];                    //!< Desired positions of markers 1-3, Q32
+    uint32_t increment[3];                  //!< Desired position step per sample, Q32
+} AdcQuantile;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Clears an estimator and sets its quantile.
+ *
+ * @param q Estimator to initialize.
+ * @param p Quantile to estimate, e.g. 0.99f (0 < p < 1).
+ */
+void AdcQuantileInit(AdcQuantile *q, float p);
+
+/**
+ * @brief Adds one sample.
+ *
+ * @param q Estimator to update.
+ * @param x Sample value.
+ */
+void AdcQuantileUpdate(AdcQuantile *q, float x);
+
+/**
+ * @brief Adds a block of raw codes of one channel.
+ *
+ * The estimate is affine-equivariant, so codes can be fed directly and the
+ * result converted to volts at report time (calibration slope > 0).
+ *
+ * @param q Estimator to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcQuantileUpdateCodes(AdcQuantile *q, const uint16_t *in, size_t n,
+                            size_t stride);
+
+/**
+ * @brief Returns the current quantile estimate (0 if no samples).
+ *
+ * With fewer than five samples, the nearest-rank sample is returned.
+ */
+float AdcQuantileValue(const AdcQuantile *q);
+
+#endif /* ADC_QUANTILE_H_ */
@@ -0,0 +1,352 @@
+/**
+ * @file adc_scan.c
+ * @brief Burst-mode multi-channel scan across ADCA, ADCB, ADCC and ADCD.
+ *
+ * This file sweeps a list of channels on all four converters in parallel.
+ * Every converter uses all 16 SOCs with round-robin priority and burst mode,
+ * with a burst size of 16, so one trigger converts the whole round-robin
+ * wheel exactly once. ADCINT1 is raised by SOC15, the last SOC of the wheel,
+ * which makes the ISR see a complete, consistent frame on every trigger.
+ *
+ * A list shorter than 16 channels is repeated around the wheel
+ * (SOC k -> channels[k % numChannels]) and the repeated conversions are
+ * averaged, so the extra SOCs improve resolution instead of being wasted.
+ *
+ * @date Created on: Mar 02, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_scan.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief SOC that completes the round-robin wheel and raises ADCINT1.
+ */
+#define ADC_SCAN_LAST_SOC       ((ADC_SOCNumber)(ADC_SCAN_SOCS - 1U))
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Run-time state of one scanned converter.
+ */
+typedef struct
+{
+    uint32_t base;          // ADC module base
+    uint32_t resultBase;    // ADC result register base
+    uint16_t numChannels;   // 1, 2, 4, 8 or 16
+    uint16_t avgShift;      // log2(16 / numChannels)
+} AdcScanActive;
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+const AdcScanConverter adcScanDefaultList[ADC_SCAN_NUM_CONVERTERS] =
+{
+    { ADCA_BASE, ADCARESULT_BASE, ADC_RESOLUTION_16BIT, ADC_MODE_DIFFERENTIAL, 4U,
+      { ADC_CH_ADCIN0_ADCIN1, ADC_CH_ADCIN2_ADCIN3,
+        ADC_CH_ADCIN4_ADCIN5, ADC_CH_ADCIN14_ADCIN15 } },
+    { ADCB_BASE, ADCBRESULT_BASE, ADC_RESOLUTION_12BIT, ADC_MODE_SINGLE_ENDED, 4U,
+      { ADC_CH_ADCIN2, ADC_CH_ADCIN3, ADC_CH_ADCIN4, ADC_CH_ADCIN5 } },
+    { ADCC_BASE, ADCCRESULT_BASE, ADC_RESOLUTION_12BIT, ADC_MODE_SINGLE_ENDED, 4U,
+      { ADC_CH_ADCIN2, ADC_CH_ADCIN3, ADC_CH_ADCIN4, ADC_CH_ADCIN5 } },
+    { ADCD_BASE, ADCDRESULT_BASE, ADC_RESOLUTION_12BIT, ADC_MODE_SINGLE_ENDED, 4U,
+      { ADC_CH_ADCIN0, ADC_CH_ADCIN1, ADC_CH_ADCIN2, ADC_CH_ADCIN3 } },
+};
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+static AdcScanActive scanActive[ADC_SCAN_NUM_CONVERTERS];
+static uint16_t scanNumActive = 0;
+
+// Per output channel conversion: voltage = (code - offset) * scale
+static float scanScale[ADC_SCAN_MAX_CHANNELS];
+static float scanOffset[ADC_SCAN_MAX_CHANNELS];
+
+// Double-buffered frames: the ISR fills one while the other is readable
+static AdcScanFrame scanFrames[2];
+static volatile uint16_t scanReadIndex = 0;     // Last completed frame
+static volatile uint32_t scanSequence = 0;      // Frames completed
+static volatile uint32_t scanOverflows = 0;     // Bursts lost to ADCINT1 overflow
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Returns log2(16 / numChannels), or -1 if numChannels is not valid.
+ */
+static int16_t AdcScanAverageShift(uint16_t numChannels)
+{
+    switch (numChannels)
+    {
+    case 1U:  return 4;
+    case 2U:  return 3;
+    case 4U:  return 2;
+    case 8U:  return 1;
+    case 16U: return 0;
+    default:  return -1;
+    }
+}
+
+/**
+ * @brief Powers up one converter in the resolution and mode of the scan list.
+ *
+ * Same sequence as myADCA_init()/myADCB_init() in board.c; ADCC and ADCD are
+ * clocked by SysCtl but not initialized by SysConfig.
+ */
+static void AdcScanPowerUp(const AdcScanConverter *cv)
+{
+    ADC_setPrescaler(cv->base, ADC_CLK_DIV_4_0);
+    ADC_setMode(cv->base, cv->resolution, cv->signalMode);
+    ADC_setInterruptPulseMode(cv->base, ADC_PULSE_END_OF_CONV);
+    ADC_enableConverter(cv->base);
+
+    // Delay for 1ms to allow ADC time to power up
+    DEVICE_DELAY_US(1000);
+}
+
+/**
+ * @brief Configures burst-mode scanning on every converter in the list.
+ *
+ * @param list Scan list, one entry per converter (ADC_SCAN_NUM_CONVERTERS).
+ * @param trigger Burst trigger shared by all converters (e.g. ePWM1 SOCA).
+ * @return false if a channel count is not 0, 1, 2, 4, 8 or 16.
+ */
+bool AdcScanInit(const AdcScanConverter list[], ADC_Trigger trigger)
+{
+    uint16_t c, soc, i;
+    uint16_t out = 0;
+    uint16_t numActive = 0;
+    uint32_t firstBase = 0;
+
+    // Validate the whole list before touching the hardware
+    for (c = 0; c < ADC_SCAN_NUM_CONVERTERS; c++)
+    {
+        if ((list[c].numChannels != 0U) && (AdcScanAverageShift(list[c].numChannels) < 0))
+            return false;
+    }
+
+    for (c = 0; c < ADC_SCAN_NUM_CONVERTERS; c++)
+    {
+        const AdcScanConverter *cv = &list[c];
+        float scale, offset;
+
+        if (cv->numChannels == 0U)
+            continue;
+
+        AdcScanPowerUp(cv);
+
+        //
+        // SOCs: the burst trigger replaces the per-SOC trigger in burst mode
+        //
+        ADC_disableBurstMode(cv->base);
+        for (soc = 0; soc < ADC_SCAN_SOCS; soc++)
+        {
+            ADC_setupSOC(cv->base, (ADC_SOCNumber)soc, ADC_TRIGGER_SW_ONLY,
+                         cv->channels[soc % cv->numChannels], ADC_SAMPLE_WINDOW);
+            ADC_setInterruptSOCTrigger(cv->base, (ADC_SOCNumber)soc,
+                                       ADC_INT_SOC_TRIGGER_NONE);
+        }
+
+        ADC_setBurstModeConfig(cv->base, trigger, ADC_SCAN_SOCS);
+        ADC_enableBurstMode(cv->base);
+
+        // Rewriting SOCPRIORITY also resets the round-robin pointer, so the
+        // first burst starts at SOC0 and every burst covers SOC0..SOC15
+        ADC_setSOCPriority(cv->base, ADC_PRI_ALL_ROUND_ROBIN);
+
+        //
+        // ADC Interrupt 1: end of the wheel
+        //
+        ADC_setInterruptSource(cv->base, ADC_INT_NUMBER1, ADC_SCAN_LAST_SOC);
+        ADC_disableContinuousMode(cv->base, ADC_INT_NUMBER1);
+        ADC_enableInterrupt(cv->base, ADC_INT_NUMBER1);
+        ADC_clearInterruptStatus(cv->base, ADC_INT_NUMBER1);
+        ADC_clearInterruptOverflowStatus(cv->base, ADC_INT_NUMBER1);
+
+        //
+        // Output channels of this converter
+        //
+        if (cv->resolution == ADC_RESOLUTION_16BIT)
+            scale = DIFFERENTIAL;
+        else
+            scale = SINGLE_ENDED;
+
+        if (cv->signalMode == ADC_MODE_DIFFERENTIAL)
+            offset = (cv->resolution == ADC_RESOLUTION_16BIT) ? 32768.0F : 2048.0F;
+        else
+            offset = 0.0F;
+
+        for (i = 0; i < cv->numChannels; i++)
+        {
+            scanScale[out] = scale;
+            scanOffset[out] = offset;
+            out++;
+        }
+
+        scanActive[numActive].base = cv->base;
+        scanActive[numActive].resultBase = cv->resultBase;
+        scanActive[numActive].numChannels = cv->numChannels;
+        scanActive[numActive].avgShift = (uint16_t)AdcScanAverageShift(cv->numChannels);
+        if (numActive == 0U)
+            firstBase = cv->base;
+        numActive++;
+    }
+
+    scanNumActive = numActive;
+    scanReadIndex = 0;
+    scanSequence = 0;
+    scanOverflows = 0;
+
+    if (numActive == 0U)
+        return true;
+
+    //
+    // Interrupt: the first scanned converter signals the end of the frame
+    //
+    Interrupt_disable(INT_ADCA1);
+    Interrupt_disable(INT_ADCB1);
+    Interrupt_disable(INT_ADCC1);
+    Interrupt_disable(INT_ADCD1);
+
+    switch (firstBase)
+    {
+    case ADCA_BASE:
+        Interrupt_register(INT_ADCA1, &AdcScanISR);
+        Interrupt_enable(INT_ADCA1);
+        break;
+    case ADCB_BASE:
+        Interrupt_register(INT_ADCB1, &AdcScanISR);
+        Interrupt_enable(INT_ADCB1);
+        break;
+    case ADCC_BASE:
+        Interrupt_register(INT_ADCC1, &AdcScanISR);
+        Interrupt_enable(INT_ADCC1);
+        break;
+    default:
+        Interrupt_register(INT_ADCD1, &AdcScanISR);
+        Interrupt_enable(INT_ADCD1);
+        break;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Copies the most recent complete scan frame.
+ *
+ * The ISR always writes the frame that is not currently published, and the
+ * sequence number is re-checked after the copy, so a frame completed during
+ * the copy causes a retry instead of a torn read.
+ *
+ * @param frame Receives the frame.
+ * @return true if at least one frame has been completed.
+ */
+bool AdcScanReadFrame(AdcScanFrame *frame)
+{
+    uint32_t sequence;
+    uint16_t i;
+
+    do
+    {
+        const AdcScanFrame *src;
+
+        sequence = scanSequence;
+        src = &scanFrames[scanReadIndex];
+
+        frame->sequence = src->sequence;
+        frame->numChannels = src->numChannels;
+        for (i = 0; i < src->numChannels; i++)
+            frame->code[i] = src->code[i];
+    } while (sequence != scanSequence);
+
+    return (sequence != 0U);
+}
+
+/**
+ * @brief Converts the codes of a scan frame to voltage values.
+ *
+ * @param voltage Array to store the voltages (minimum size: frame->numChannels).
+ * @param frame Frame to convert.
+ */
+void AdcScanResult(float voltage[], const AdcScanFrame *frame)
+{
+    uint16_t i;
+
+    for (i = 0; i < frame->numChannels; i++)
+        voltage[i] = ((float)frame->code[i] - scanOffset[i]) * scanScale[i];
+}
+
+/**
+ * @brief Returns the number of bursts lost to an ADCINT1 overflow.
+ */
+uint32_t AdcScanGetOverflows(void)
+{
+    return scanOverflows;
+}
+
+/**
+ * @brief Frame-complete ISR: averages the SOC results of all converters.
+ *
+ * Raised by SOC15 of the first scanned converter. All converters start their
+ * burst on the same trigger, but their conversion times differ (16-bit vs
+ * 12-bit), so the ISR waits for each converter's own ADCINT1 before reading
+ * its results.
+ */
+__interrupt void AdcScanISR(void)
+{
+    uint16_t writeIndex = scanReadIndex ^ 1U;
+    AdcScanFrame *frame = &scanFrames[writeIndex];
+    uint16_t c, soc, i;
+    uint16_t out = 0;
+
+    for (c = 0; c < scanNumActive; c++)
+    {
+        const AdcScanActive *cv = &scanActive[c];
+        const volatile uint16_t *result =
+            (const volatile uint16_t *)(cv->resultBase + ADC_RESULTx_OFFSET_BASE);
+        uint16_t mask = cv->numChannels - 1U;
+        uint32_t sum[ADC_SCAN_SOCS];
+
+        while (!ADC_getInterruptStatus(cv->base, ADC_INT_NUMBER1))
+        {
+        }
+
+        for (i = 0; i < cv->numChannels; i++)
+            sum[i] = 0;
+
+        // SOC k holds channels[k % numChannels]; numChannels is a power of two
+        for (soc = 0; soc < ADC_SCAN_SOCS; soc++)
+            sum[soc & mask] += result[soc];
+
+        for (i = 0; i < cv->numChannels; i++)
+            frame->code[out++] = (uint16_t)(sum[i] >> cv->avgShift);
+
+        ADC_clearInterruptStatus(cv->base, ADC_INT_NUMBER1);
+
+        // A trigger arrived before the previous flag was cleared: frame lost
+        if (ADC_getInterruptOverflowStatus(cv->base, ADC_INT_NUMBER1))
+        {
+            ADC_clearInterruptOverflowStatus(cv->base, ADC_INT_NUMBER1);
+            ADC_clearInterruptStatus(cv->base, ADC_INT_NUMBER1);
+            scanOverflows++;
+        }
+    }
+
+    frame->numChannels = out;
+    frame->sequence = scanSequence + 1U;
+
+    // Publish the frame
+    scanReadIndex = writeIndex;
+    scanSequence = frame->sequence;
+
+    Interrupt_clearACKGroup(INTERRUPT_ACK_GROUP1);
+}
@@ -0,0 +1,139 @@
+/**
+ * @file adc_scan.h
+ * @brief Header file for the burst-mode multi-channel scan engine.
+ *
+ * This file contains definitions and function declarations for scanning a
+ * list of channels on all four ADC modules in parallel. Each converter runs in
+ * burst mode with round-robin SOC priority, so one trigger walks through all
+ * 16 of its SOCs, and the four converters together deliver one complete scan
+ * frame per trigger.
+ *
+ * @date Created on: Mar 02, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_SCAN_H_
+#define ADC_SCAN_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"          // Include SysConfig generated header
+#include "adc_config.h"     // Scale factors, ADC_SAMPLE_WINDOW
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Number of ADC modules on the F28379D (ADCA..ADCD).
+ */
+#define ADC_SCAN_NUM_CONVERTERS     4U
+
+/**
+ * @brief SOCs per converter; also the burst size of every scan.
+ */
+#define ADC_SCAN_SOCS               16U
+
+/**
+ * @brief Largest number of channels in one scan frame.
+ */
+#define ADC_SCAN_MAX_CHANNELS       (ADC_SCAN_NUM_CONVERTERS * ADC_SCAN_SOCS)
+
+/**
+ * @brief Highest frame (trigger) rate for a scan that includes ADCA.
+ *
+ * One burst is 16 conversions; a 16-bit differential conversion with the
+ * 200 SYSCLK sample window takes about 2 us, so a burst lasts about 32 us.
+ */
+#define ADC_SCAN_MAX_FRAME_RATE_HZ  25000UL
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Scan list of one converter.
+ *
+ * All 16 SOCs are used: SOC k converts channels[k % numChannels]. numChannels
+ * must be 0 (converter not scanned), 1, 2, 4, 8 or 16, so every channel gets
+ * 16 / numChannels conversions per frame, which are averaged.
+ */
+typedef struct
+{
+    uint32_t base;                          //!< ADC module base
+    uint32_t resultBase;                    //!< ADC result register base
+    ADC_Resolution resolution;              //!< 12-bit or 16-bit
+    ADC_SignalMode signalMode;              //!< Single-ended or differential
+    uint16_t numChannels;                   //!< Channels in the list
+    ADC_Channel channels[ADC_SCAN_SOCS];    //!< Channels to scan
+} AdcScanConverter;
+
+/**
+ * @brief One complete scan frame.
+ *
+ * Codes are stored converter by converter (ADCA list, then ADCB, ...), in the
+ * order of each converter's channel list.
+ */
+typedef struct
+{
+    uint32_t sequence;                      //!< Frame number (0 = none yet)
+    uint16_t numChannels;                   //!< Valid entries in code[]
+    uint16_t code[ADC_SCAN_MAX_CHANNELS];   //!< Averaged raw codes
+} AdcScanFrame;
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+/**
+ * @brief Default scan list: 16 channels available on the LaunchPad headers.
+ */
+extern const AdcScanConverter adcScanDefaultList[ADC_SCAN_NUM_CONVERTERS];
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Configures burst-mode scanning on every converter in the list.
+ *
+ * Powers up converters not initialized by SysConfig (ADCC, ADCD), maps the
+ * SOCs, enables burst mode (16 conversions per trigger) with round-robin
+ * priority and registers the frame ISR on the first scanned converter.
+ *
+ * @param list Scan list, one entry per converter (ADC_SCAN_NUM_CONVERTERS).
+ * @param trigger Burst trigger shared by all converters (e.g. ePWM1 SOCA).
+ * @return false if a channel count is not 0, 1, 2, 4, 8 or 16.
+ */
+bool AdcScanInit(const AdcScanConverter list[], ADC_Trigger trigger);
+
+/**
+ * @brief Copies the most recent complete scan frame.
+ *
+ * @param frame Receives the frame.
+ * @return true if at least one frame has been completed.
+ */
+bool AdcScanReadFrame(AdcScanFrame *frame);
+
+/**
+ * @brief Converts the codes of a scan frame to voltage values.
+ *
+ * @param voltage Array to store the voltages (minimum size: frame->numChannels).
+ * @param frame Frame to convert.
+ */
+void AdcScanResult(float voltage[], const AdcScanFrame *frame);
+
+/**
+ * @brief Returns the number of bursts lost to an ADCINT1 overflow.
+ */
+uint32_t AdcScanGetOverflows(void);
+
+/**
+ * @brief Frame-complete ISR: averages the SOC results of all converters.
+ */
+__interrupt void AdcScanISR(void);
+
+#endif /* ADC_SCAN_H_ */
@@ -0,0 +1,122 @@
+/**
+ * @file adc_simultaneous.c
+ * @brief Simultaneous sampling of ADCA and ADCB with skew self-measurement.
+ *
+ * AdcConversion() forces ADCA, waits, and only then forces ADCB, so the two
+ * channels are skewed by a full conversion plus polling overhead. Here both
+ * SOC0s listen to the same ePWM1 SOCA signal, and a software-forced SOCA pulse
+ * starts them on the same SYSCLK edge.
+ *
+ * Skew self-measurement: each converter's PPB records the number of SYSCLK
+ * cycles between the SOC trigger and the start of sampling. With a shared
+ * trigger, the difference of the two delay stamps is the sampling skew.
+ *
+ * @date Created on: Feb 16, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_simultaneous.h"
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Prepares both converters for shared-trigger sampling.
+ */
+void AdcSimultaneousInit(void)
+{
+    // SOC0 of both converters -> ePWM1 SOCA; timebase stays frozen
+    AdcAcquisitionInit(ADC_ACQ_MAX_RATE_HZ);
+    Interrupt_disable(INT_ADCA1);
+    EPWM_enableADCTrigger(ADC_ACQ_EPWM_BASE, EPWM_SOC_A);
+
+    // PPB delay stamps on SOC0 of each converter
+    ADC_setupPPB(myADCA_BASE, ADC_SIM_STAMP_PPB, myADCA_SOC0);
+    ADC_setupPPB(myADCB_BASE, ADC_SIM_STAMP_PPB, myADCB_SOC0);
+
+    CycleCounterInit();
+}
+
+/**
+ * @brief Converts both channels from one shared software trigger.
+ *
+ * Forcing SOCA on the ePWM (instead of ADC_forceSOC on each converter) puts a
+ * single pulse on the trigger line seen by both ADCs.
+ *
+ * @param sample Receives the timestamp and both raw results.
+ */
+void AdcSimultaneousConvert(AdcTimedSample *sample)
+{
+    ADC_clearInterruptStatus(myADCA_BASE, ADC_INT_NUMBER1);
+    ADC_clearInterruptStatus(myADCB_BASE, ADC_INT_NUMBER1);
+
+    sample->timestamp = CycleCounterRead();
+    EPWM_forceADCTrigger(ADC_ACQ_EPWM_BASE, EPWM_SOC_A);
+
+    // Wait for both conversions of this trigger
+    while ((ADC_getInterruptStatus(myADCA_BASE, ADC_INT_NUMBER1) == false) ||
+           (ADC_getInterruptStatus(myADCB_BASE, ADC_INT_NUMBER1) == false))
+    {
+        // Waiting for ADCINT1 on both converters
+    }
+    ADC_clearInterruptStatus(myADCA_BASE, ADC_INT_NUMBER1);
+    ADC_clearInterruptStatus(myADCB_BASE, ADC_INT_NUMBER1);
+
+    sample->raw[0] = ADC_readResult(myADCA_RESULT_BASE, myADCA_SOC0);
+    sample->raw[1] = ADC_readResult(myADCB_RESULT_BASE, myADCB_SOC0);
+}
+
+/**
+ * @brief Measures the inter-channel sampling skew over several triggers.
+ *
+ * Zero skew means both converters opened their sample window on the same
+ * SYSCLK edge (sub-cycle alignment, 5 ns at 200 MHz).
+ *
+ * @param numTriggers Number of shared triggers to issue (at least 1).
+ * @param result Receives the skew statistics.
+ */
+void AdcSimultaneousMeasureSkew(uint16_t numTriggers, AdcSkewResult *result)
+{
+    AdcTimedSample sample;
+    uint16_t i;
+    uint16_t delayA;
+    uint16_t delayB;
+    int16_t skew;
+    int32_t sumSkew = 0;
+
+    if (numTriggers == 0U)
+        numTriggers = 1U;
+
+    result->numTriggers = numTriggers;
+    result->minSkew = INT16_MAX;
+    result->maxSkew = INT16_MIN;
+    result->maxDelayA = 0;
+    result->maxDelayB = 0;
+
+    for (i = 0; i < numTriggers; i++)
+    {
+        AdcSimultaneousConvert(&sample);
+
+        delayA = ADC_getPPBDelayTimeStamp(myADCA_BASE, ADC_SIM_STAMP_PPB);
+        delayB = ADC_getPPBDelayTimeStamp(myADCB_BASE, ADC_SIM_STAMP_PPB);
+        skew = (int16_t)delayA - (int16_t)delayB;
+
+        if (skew < result->minSkew)
+            result->minSkew = skew;
+        if (skew > result->maxSkew)
+            result->maxSkew = skew;
+        if (delayA > result->maxDelayA)
+            result->maxDelayA = delayA;
+        if (delayB > result->maxDelayB)
+            result->maxDelayB = delayB;
+
+        sumSkew += skew;
+    }
+
+    result->meanSkew = (float)sumSkew / (float)numTriggers;
+    result->aligned = (result->minSkew == 0) && (result->maxSkew == 0);
+}
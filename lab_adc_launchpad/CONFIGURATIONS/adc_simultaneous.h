@@ -0,0 +1,96 @@
+/**
+ * @file adc_simultaneous.h
+ * @brief Header file for simultaneous sampling of ADCA and ADCB.
+ *
+ * This file contains definitions and function declarations for converting
+ * both channels from one shared trigger. A single ePWM1 SOCA pulse (forced in
+ * software or generated by the running timebase) starts SOC0 on both
+ * converters at the same SYSCLK edge, and the results are returned together
+ * as one timestamped sample tuple.
+ *
+ * @date Created on: Feb 16, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_SIMULTANEOUS_H_
+#define ADC_SIMULTANEOUS_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"              // Include SysConfig generated header
+#include "adc_acquisition.h"    // ePWM1 SOCA routing
+#include "cycle_counter.h"      // Sample timestamps
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief PPB used on each converter to capture the trigger-to-sample delay.
+ */
+#define ADC_SIM_STAMP_PPB       ADC_PPB_NUMBER1
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief One simultaneous sample: results of all channels from one trigger.
+ */
+typedef struct
+{
+    uint32_t timestamp;             //!< Cycle counter at the shared trigger
+    uint16_t raw[NUM_ADC_CHANNELS]; //!< Raw results (0 = ADCA, 1 = ADCB)
+} AdcTimedSample;
+
+/**
+ * @brief Result of the inter-channel skew self-measurement.
+ *
+ * Skew is (ADCA delay - ADCB delay) in SYSCLK cycles, where each delay is the
+ * PPB time stamp between the shared trigger and the start of sampling.
+ */
+typedef struct
+{
+    uint16_t numTriggers;   //!< Number of shared triggers measured
+    int16_t minSkew;        //!< Smallest skew seen (SYSCLK cycles)
+    int16_t maxSkew;        //!< Largest skew seen (SYSCLK cycles)
+    float meanSkew;         //!< Mean skew (SYSCLK cycles)
+    uint16_t maxDelayA;     //!< Worst trigger-to-sample delay on ADCA
+    uint16_t maxDelayB;     //!< Worst trigger-to-sample delay on ADCB
+    bool aligned;           //!< true if every trigger had zero skew
+} AdcSkewResult;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Prepares both converters for shared-trigger sampling.
+ *
+ * Routes SOC0 of ADCA and ADCB to ePWM1 SOCA (via AdcAcquisitionInit()),
+ * keeps the timebase frozen so only software-forced pulses trigger, disables
+ * the ADCA1 CPU interrupt and enables the PPB delay time stamps. Call
+ * AdcAcquisitionInit() again afterwards to switch to ePWM-paced acquisition.
+ */
+void AdcSimultaneousInit(void);
+
+/**
+ * @brief Converts both channels from one shared software trigger.
+ *
+ * @param sample Receives the timestamp and both raw results.
+ */
+void AdcSimultaneousConvert(AdcTimedSample *sample);
+
+/**
+ * @brief Measures the inter-channel sampling skew over several triggers.
+ *
+ * @param numTriggers Number of shared triggers to issue (at least 1).
+ * @param result Receives the skew statistics.
+ */
+void AdcSimultaneousMeasureSkew(uint16_t numTriggers, AdcSkewResult *result);
+
+#endif /* ADC_SIMULTANEOUS_H_ */
@@ -0,0 +1,250 @@
+/**
+ * @file adc_smooth.c
+ * @brief O(1) moving-average and exponential smoothing filters on raw codes.
+ *
+ * This file contains the running-sum moving average and the shift-only
+ * exponential moving average on raw codes.
+ *
+ * @date Created on: Jun 29, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_smooth.h"
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Code rings of all moving averages in GS RAM
+#pragma DATA_SECTION(smoothPool, "adcsmooth")
+static uint16_t smoothPool[ADC_SMOOTH_POOL_WORDS];
+
+static uint16_t smoothUsed = 0;     // Words allocated from smoothPool
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Moving-average update without the start-up branch.
+ */
+static inline void AdcMovingAverageStep(AdcMovingAverage *ma, uint16_t code)
+{
+    uint16_t pos = ma->pos;
+
+    ma->sum += (uint32_t)code - ma->ring[pos];
+    ma->ring[pos] = code;
+    ma->pos = (pos + 1U) & ma->mask;
+}
+
+/**
+ * @brief Fills the ring with the first code.
+ */
+static void AdcMovingAveragePrime(AdcMovingAverage *ma, uint16_t code)
+{
+    uint16_t i;
+
+    for (i = 0; i <= ma->mask; i++)
+        ma->ring[i] = code;
+
+    ma->sum = (uint32_t)code << ma->log2Length;
+    ma->pos = 0;
+    ma->primed = true;
+}
+
+/**
+ * @brief EMA update without the start-up branch.
+ */
+static inline void AdcEmaStep(AdcEma *ema, uint16_t code)
+{
+    uint32_t x = (uint32_t)code << ADC_SMOOTH_EMA_FRAC_BITS;
+    uint32_t round = (ema->shift > 0U) ? (1UL << (ema->shift - 1U)) : 0U;
+
+    if (x >= ema->state)
+        ema->state += (x - ema->state + round) >> ema->shift;
+    else
+        ema->state -= (ema->state - x + round) >> ema->shift;
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Releases the ring pool (averages created before become invalid).
+ */
+void AdcSmoothPoolReset(void)
+{
+    smoothUsed = 0;
+}
+
+/**
+ * @brief Creates a moving average and allocates its ring from the pool.
+ *
+ * @param ma Moving average to create.
+ * @param log2Length k: window of 2^k samples (0 to ADC_SMOOTH_MAX_LOG2).
+ * @return false if k is out of range or the pool is exhausted.
+ */
+bool AdcMovingAverageCreate(AdcMovingAverage *ma, uint16_t log2Length)
+{
+    uint16_t length;
+
+    if (log2Length > ADC_SMOOTH_MAX_LOG2)
+        return false;
+
+    length = 1U << log2Length;
+    if ((uint32_t)smoothUsed + length > ADC_SMOOTH_POOL_WORDS)
+        return false;
+
+    ma->ring = &smoothPool[smoothUsed];
+    smoothUsed += length;
+
+    ma->log2Length = log2Length;
+    ma->mask = length - 1U;
+    AdcMovingAverageClear(ma);
+
+    return true;
+}
+
+/**
+ * @brief Empties a moving average (the next code refills the whole ring).
+ *
+ * @param ma Moving average to clear.
+ */
+void AdcMovingAverageClear(AdcMovingAverage *ma)
+{
+    ma->pos = 0;
+    ma->sum = 0;
+    ma->primed = false;
+}
+
+/**
+ * @brief Adds one code to a moving average.
+ *
+ * @param ma Moving average to update.
+ * @param code Raw ADC code.
+ */
+void AdcMovingAverageUpdate(AdcMovingAverage *ma, uint16_t code)
+{
+    if (!ma->primed)
+        AdcMovingAveragePrime(ma, code);
+    else
+        AdcMovingAverageStep(ma, code);
+}
+
+/**
+ * @brief Adds a block of codes of one channel to a moving average.
+ *
+ * @param ma Moving average to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcMovingAverageUpdateBlock(AdcMovingAverage *ma, const uint16_t *in, size_t n,
+                                 size_t stride)
+{
+    size_t i;
+
+    if (n == 0U)
+        return;
+
+    if (!ma->primed)
+        AdcMovingAveragePrime(ma, in[0]);
+
+    for (i = 0; i < n; i++)
+        AdcMovingAverageStep(ma, in[i * stride]);
+}
+
+/**
+ * @brief Returns the moving average in codes (0 before the first code).
+ *
+ * @param ma Moving average to read.
+ */
+float AdcMovingAverageValue(const AdcMovingAverage *ma)
+{
+    return (float)ma->sum / (float)(1UL << ma->log2Length);
+}
+
+/**
+ * @brief Sets up an exponential moving average.
+ *
+ * @param ema Filter to set up.
+ * @param shift k: alpha = 2^-k (0 to ADC_SMOOTH_MAX_SHIFT).
+ * @return false if k is out of range.
+ */
+bool AdcEmaInit(AdcEma *ema, uint16_t shift)
+{
+    if (shift > ADC_SMOOTH_MAX_SHIFT)
+        return false;
+
+    ema->shift = shift;
+    AdcEmaClear(ema);
+
+    return true;
+}
+
+/**
+ * @brief Empties an exponential moving average (the next code sets the state).
+ *
+ * @param ema Filter to clear.
+ */
+void AdcEmaClear(AdcEma *ema)
+{
+    ema->state = 0;
+    ema->primed = false;
+}
+
+/**
+ * @brief Adds one code to an exponential moving average.
+ *
+ * @param ema Filter to update.
+ * @param code Raw ADC code.
+ */
+void AdcEmaUpdate(AdcEma *ema, uint16_t code)
+{
+    if (!ema->primed)
+    {
+        ema->state = (uint32_t)code << ADC_SMOOTH_EMA_FRAC_BITS;
+        ema->primed = true;
+        return;
+    }
+
+    AdcEmaStep(ema, code);
+}
+
+/**
+ * @brief Adds a block of codes of one channel to an exponential moving average.
+ *
+ * @param ema Filter to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcEmaUpdateBlock(AdcEma *ema, const uint16_t *in, size_t n, size_t stride)
+{
+    size_t i;
+
+    if (n == 0U)
+        return;
+
+    if (!ema->primed)
+    {
+        ema->state = (uint32_t)in[0] << ADC_SMOOTH_EMA_FRAC_BITS;
+        ema->primed = true;
+    }
+
+    for (i = 0; i < n; i++)
+        AdcEmaStep(ema, in[i * stride]);
+}
+
+/**
+ * @brief Returns the exponential moving average in codes (0 before the first code).
+ *
+ * @param ema Filter to read.
+ */
+float AdcEmaValue(const AdcEma *ema)
+{
+    return (float)ema->state / (float)(1UL << ADC_SMOOTH_EMA_FRAC_BITS);
+}
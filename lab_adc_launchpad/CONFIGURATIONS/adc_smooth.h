@@ -0,0 +1,164 @@
+/**
+ * @file adc_smooth.h
+ * @brief Header file for O(1) moving-average and exponential smoothing filters.
+ *
+ * This file contains definitions and function declarations for O(1)
+ * moving-average and exponential smoothing of raw codes.
+ *
+ * @date Created on: Jun 29, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_SMOOTH_H_
+#define ADC_SMOOTH_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Words in the moving-average ring pool (section adcsmooth -> RAMGS14).
+ */
+#define ADC_SMOOTH_POOL_WORDS       4096U
+
+/**
+ * @brief Longest moving average: 2^ADC_SMOOTH_MAX_LOG2 samples.
+ */
+#define ADC_SMOOTH_MAX_LOG2         12U
+
+/**
+ * @brief Largest EMA shift (alpha = 2^-15, time constant about 32768 samples).
+ */
+#define ADC_SMOOTH_MAX_SHIFT        15U
+
+/**
+ * @brief Fractional bits of the EMA state.
+ */
+#define ADC_SMOOTH_EMA_FRAC_BITS    16U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Boxcar moving average over the last 2^log2Length codes.
+ */
+typedef struct
+{
+    uint16_t *ring;         //!< Last 2^log2Length codes
+    uint16_t log2Length;    //!< k: window of 2^k samples
+    uint16_t mask;          //!< 2^k - 1
+    uint16_t pos;           //!< Oldest code, overwritten next
+    bool primed;            //!< Ring filled (with the first code on start)
+    uint32_t sum;           //!< Sum of the ring
+} AdcMovingAverage;
+
+/**
+ * @brief Exponential moving average, y += (x - y) / 2^shift.
+ */
+typedef struct
+{
+    uint32_t state;         //!< y in codes, Q16
+    uint16_t shift;         //!< k: alpha = 2^-k
+    bool primed;            //!< State set from the first code
+} AdcEma;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Releases the ring pool (averages created before become invalid).
+ */
+void AdcSmoothPoolReset(void);
+
+/**
+ * @brief Creates a moving average and allocates its ring from the pool.
+ *
+ * @param ma Moving average to create.
+ * @param log2Length k: window of 2^k samples (0 to ADC_SMOOTH_MAX_LOG2).
+ * @return false if k is out of range or the pool is exhausted.
+ */
+bool AdcMovingAverageCreate(AdcMovingAverage *ma, uint16_t log2Length);
+
+/**
+ * @brief Empties a moving average (the next code refills the whole ring).
+ *
+ * @param ma Moving average to clear.
+ */
+void AdcMovingAverageClear(AdcMovingAverage *ma);
+
+/**
+ * @brief Adds one code to a moving average.
+ *
+ * @param ma Moving average to update.
+ * @param code Raw ADC code.
+ */
+void AdcMovingAverageUpdate(AdcMovingAverage *ma, uint16_t code);
+
+/**
+ * @brief Adds a block of codes of one channel to a moving average.
+ *
+ * @param ma Moving average to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcMovingAverageUpdateBlock(AdcMovingAverage *ma, const uint16_t *in, size_t n,
+                                 size_t stride);
+
+/**
+ * @brief Returns the moving average in codes (0 before the first code).
+ *
+ * @param ma Moving average to read.
+ */
+float AdcMovingAverageValue(const AdcMovingAverage *ma);
+
+/**
+ * @brief Sets up an exponential moving average.
+ *
+ * @param ema Filter to set up.
+ * @param shift k: alpha = 2^-k (0 to ADC_SMOOTH_MAX_SHIFT).
+ * @return false if k is out of range.
+ */
+bool AdcEmaInit(AdcEma *ema, uint16_t shift);
+
+/**
+ * @brief Empties an exponential moving average (the next code sets the state).
+ *
+ * @param ema Filter to clear.
+ */
+void AdcEmaClear(AdcEma *ema);
+
+/**
+ * @brief Adds one code to an exponential moving average.
+ *
+ * @param ema Filter to update.
+ * @param code Raw ADC code.
+ */
+void AdcEmaUpdate(AdcEma *ema, uint16_t code);
+
+/**
+ * @brief Adds a block of codes of one channel to an exponential moving average.
+ *
+ * @param ema Filter to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcEmaUpdateBlock(AdcEma *ema, const uint16_t *in, size_t n, size_t stride);
+
+/**
+ * @brief Returns the exponential moving average in codes (0 before the first code).
+ *
+ * @param ema Filter to read.
+ */
+float AdcEmaValue(const AdcEma *ema);
+
+#endif /* ADC_SMOOTH_H_ */
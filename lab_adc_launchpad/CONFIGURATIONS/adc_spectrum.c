@@ -0,0 +1,474 @@
+/**
+ * @file adc_spectrum.c
+ * @brief FFT-based dynamic performance metrics (IEEE 1241).
+ *
+ * This file contains the real FFT (packed as a half-length complex FFT), the
+ * Blackman-Harris window and the reduction of the spectrum to the metrics.
+ *
+ * @date Created on: May 25, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_spectrum.h"
+#include <math.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+#define ADC_SPECTRUM_PI         3.14159265358979f
+
+/**
+ * @brief 4-term Blackman-Harris coefficients (-92 dB sidelobes).
+ */
+#define ADC_SPECTRUM_BH_A0      0.35875f
+#define ADC_SPECTRUM_BH_A1      0.48829f
+#define ADC_SPECTRUM_BH_A2      0.14128f
+#define ADC_SPECTRUM_BH_A3      0.01168f
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Record, FFT work buffer and power spectrum (in place)
+#pragma DATA_SECTION(spectrumBuffer, "adcfftbuf")
+static float spectrumBuffer[ADC_SPECTRUM_MAX_POINTS];
+
+// Window w[0..N/2-1]; w[N/2] is spectrumWindowMid
+#pragma DATA_SECTION(spectrumWindow, "adcfftwin")
+static float spectrumWindow[ADC_SPECTRUM_MAX_POINTS / 2U];
+
+// Quarter-wave sine s[0..N/4]
+#pragma DATA_SECTION(spectrumSine, "adcfftsin")
+static float spectrumSine[ADC_SPECTRUM_MAX_POINTS / 4U + 1U];
+
+static uint16_t spectrumPoints = 0;     // Record length N
+static uint16_t spectrumFilled = 0;     // Codes in the record
+static bool spectrumAnalyzed = false;   // Buffer holds the power spectrum
+static float spectrumWindowMid = 0.0f;  // w[N/2]
+static float spectrumPowerScale = 0.0f; // |X|^2 -> mean square, 2 / (N sum w^2)
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Returns cos and sin of 2 pi k / N for 0 <= k < N / 2.
+ */
+static inline void AdcSpectrumTwiddle(uint16_t k, float *c, float *s)
+{
+    uint16_t quarter = spectrumPoints / 4U;
+
+    if (k <= quarter)
+    {
+        *c = spectrumSine[quarter - k];
+        *s = spectrumSine[k];
+    }
+    else
+    {
+        *c = -spectrumSine[k - quarter];
+        *s = spectrumSine[spectrumPoints / 2U - k];
+    }
+}
+
+/**
+ * @brief In-place complex FFT of M = N / 2 interleaved points (radix-2 DIT).
+ */
+static void AdcSpectrumComplexFft(float *z)
+{
+    uint16_t m = spectrumPoints / 2U;
+    uint16_t i;
+    uint16_t j = 0;
+    uint16_t span;
+
+    // Bit-reversed reordering
+    for (i = 0; i < m - 1U; i++)
+    {
+        uint16_t bit;
+
+        if (i < j)
+        {
+            float tr = z[2U * i];
+            float ti = z[2U * i + 1U];
+            z[2U * i] = z[2U * j];
+            z[2U * i + 1U] = z[2U * j + 1U];
+            z[2U * j] = tr;
+            z[2U * j + 1U] = ti;
+        }
+        bit = m >> 1;
+        while (j & bit)
+        {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
+    }
+
+    // Butterflies: W_M^q = W_N^(2q)
+    for (span = 1; span < m; span <<= 1)
+    {
+        uint16_t step = spectrumPoints / (2U * span);   // Table index per q, in W_N
+        uint16_t q;
+
+        for (q = 0; q < span; q++)
+        {
+            float wr;
+            float wi;
+            uint16_t a;
+
+            AdcSpectrumTwiddle(q * step, &wr, &wi);
+            wi = -wi;
+
+            for (a = q; a < m; a += 2U * span)
+            {
+                uint16_t b = a + span;
+                float br = z[2U * b] * wr - z[2U * b + 1U] * wi;
+                float bi = z[2U * b] * wi + z[2U * b + 1U] * wr;
+
+                z[2U * b] = z[2U * a] - br;
+                z[2U * b + 1U] = z[2U * a + 1U] - bi;
+                z[2U * a] += br;
+                z[2U * a + 1U] += bi;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Turns the complex FFT of the packed record into the real FFT.
+ */
+static void AdcSpectrumSplit(float *z)
+{
+    uint16_t m = spectrumPoints / 2U;
+    uint16_t k;
+    float z0r = z[0];
+    float z0i = z[1];
+
+    // X[0] and X[M] are real
+    z[0] = z0r + z0i;
+    z[1] = z0r - z0i;
+
+    for (k = 1; k <= m / 2U; k++)
+    {
+        uint16_t n = m - k;
+        float ar = z[2U * k];
+        float ai = z[2U * k + 1U];
+        float br = z[2U * n];
+        float bi = z[2U * n + 1U];
+        float er = 0.5f * (ar + br);
+        float ei = 0.5f * (ai - bi);
+        float or_ = 0.5f * (ai + bi);
+        float oi = -0.5f * (ar - br);
+        float wr;
+        float wi;
+        float tr;
+        float ti;
+
+        // W^k = cos - j sin
+        AdcSpectrumTwiddle(k, &wr, &wi);
+        tr = or_ * wr + oi * wi;
+        ti = oi * wr - or_ * wi;
+
+        z[2U * n] = er - tr;
+        z[2U * n + 1U] = -(ei - ti);
+        z[2U * k] = er + tr;
+        z[2U * k + 1U] = ei + ti;
+    }
+}
+
+/**
+ * @brief Returns the distance between two bins.
+ */
+static inline int32_t AdcSpectrumDistance(int32_t a, int32_t b)
+{
+    return (a > b) ? (a - b) : (b - a);
+}
+
+/**
+ * @brief Sums bins [centre - lobe, centre + lobe] clipped to [first, last].
+ */
+static float AdcSpectrumLobe(const float *p, int32_t centre, int32_t first,
+                             int32_t last, uint16_t *bins)
+{
+    int32_t lo = centre - (int32_t)ADC_SPECTRUM_LOBE_BINS;
+    int32_t hi = centre + (int32_t)ADC_SPECTRUM_LOBE_BINS;
+    int32_t k;
+    float sum = 0.0f;
+
+    if (lo < first)
+        lo = first;
+    if (hi > last)
+        hi = last;
+
+    *bins = 0;
+    for (k = lo; k <= hi; k++)
+    {
+        sum += p[k];
+        (*bins)++;
+    }
+
+    return sum;
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Builds the twiddle and window tables and starts a new record.
+ *
+ * @param points Record length: power of two, ADC_SPECTRUM_MIN_POINTS to
+ *               ADC_SPECTRUM_MAX_POINTS.
+ * @return false if the length is not supported.
+ */
+bool AdcSpectrumInit(uint16_t points)
+{
+    uint16_t i;
+    float sumSq;
+
+    if ((points < ADC_SPECTRUM_MIN_POINTS) || (points > ADC_SPECTRUM_MAX_POINTS) ||
+        ((points & (points - 1U)) != 0U))
+        return false;
+
+    spectrumPoints = points;
+
+    for (i = 0; i <= points / 4U; i++)
+        spectrumSine[i] = sinf(2.0f * ADC_SPECTRUM_PI * (float)i / (float)points);
+
+    // Periodic window: w[N - n] = w[n]
+    sumSq = 0.0f;
+    for (i = 0; i <= points / 2U; i++)
+    {
+        float t = 2.0f * ADC_SPECTRUM_PI * (float)i / (float)points;
+        float w = ADC_SPECTRUM_BH_A0 - ADC_SPECTRUM_BH_A1 * cosf(t) +
+                  ADC_SPECTRUM_BH_A2 * cosf(2.0f * t) - ADC_SPECTRUM_BH_A3 * cosf(3.0f * t);
+
+        if (i < points / 2U)
+            spectrumWindow[i] = w;
+        else
+            spectrumWindowMid = w;
+
+        // w[0] and w[N/2] appear once in the full window, the others twice
+        sumSq += ((i == 0U) || (i == points / 2U)) ? (w * w) : (2.0f * w * w);
+    }
+    spectrumPowerScale = 2.0f / ((float)points * sumSq);
+
+    spectrumFilled = 0;
+    spectrumAnalyzed = false;
+
+    return true;
+}
+
+/**
+ * @brief Appends codes of one channel to the record.
+ *
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @return true if the record is full.
+ */
+bool AdcSpectrumCapture(const uint16_t *in, size_t n, size_t stride)
+{
+    size_t i;
+
+    if (spectrumAnalyzed)
+    {
+        spectrumAnalyzed = false;
+        spectrumFilled = 0;
+    }
+
+    for (i = 0; (i < n) && (spectrumFilled < spectrumPoints); i++)
+        spectrumBuffer[spectrumFilled++] = (float)in[i * stride];
+
+    return (spectrumPoints > 0U) && (spectrumFilled == spectrumPoints);
+}
+
+/**
+ * @brief Returns true when the record is full and ready for analysis.
+ */
+bool AdcSpectrumReady(void)
+{
+    return !spectrumAnalyzed && (spectrumPoints > 0U) && (spectrumFilled == spectrumPoints);
+}
+
+/**
+ * @brief Discards a partly captured record (e.g. after lost samples).
+ */
+void AdcSpectrumClear(void)
+{
+    if (!spectrumAnalyzed && (spectrumFilled < spectrumPoints))
+        spectrumFilled = 0;
+}
+
+/**
+ * @brief Analyzes the full record and starts a new one.
+ *
+ * Bins 0..ADC_SPECTRUM_LOBE_BINS are DC. The fundamental is the largest
+ * remaining bin and owns +/-ADC_SPECTRUM_LOBE_BINS around it; its frequency
+ * is the power-weighted centre of that lobe. Harmonics are folded into the
+ * first Nyquist zone and skipped when their lobe would overlap DC, the
+ * fundamental or a previous harmonic. SFDR compares the fundamental peak bin
+ * with the largest bin outside DC and the fundamental lobe.
+ *
+ * @param fullScaleCodes Full-scale range in codes (2^bits).
+ * @param sampleRateHz Sample rate, for fundamentalHz (0 to report bins).
+ * @param out Receives the metrics.
+ * @return false if the record is not full.
+ */
+bool AdcSpectrumAnalyze(float fullScaleCodes, float sampleRateHz, AdcSpectrumResult *out)
+{
+    float *x = spectrumBuffer;
+    uint16_t n = spectrumPoints;
+    uint16_t m = n / 2U;
+    int32_t first = (int32_t)ADC_SPECTRUM_LOBE_BINS + 1;
+    int32_t centres[ADC_SPECTRUM_HARMONICS + 1U];
+    uint16_t numCentres = 1;
+    int32_t k;
+    uint16_t i;
+    uint16_t h;
+    uint16_t bins;
+    uint16_t usedBins;
+    uint16_t peak;
+    float mean;
+    float p0;
+    float pM;
+    float signal;
+    float harmonics;
+    float noise;
+    float spur;
+    float centroid;
+    float weight;
+
+    if (!AdcSpectrumReady())
+        return false;
+
+    // Mean removal keeps the float dynamic range for the AC content
+    mean = 0.0f;
+    for (i = 0; i < n; i++)
+        mean += x[i];
+    mean /= (float)n;
+
+    for (i = 0; i < m; i++)
+        x[i] = (x[i] - mean) * spectrumWindow[i];
+    x[m] = (x[m] - mean) * spectrumWindowMid;
+    for (i = m + 1U; i < n; i++)
+        x[i] = (x[i] - mean) * spectrumWindow[n - i];
+
+    AdcSpectrumComplexFft(x);
+    AdcSpectrumSplit(x);
+
+    // Power spectrum in place: P[k] in x[k], k = 0..M
+    p0 = x[0] * x[0];
+    pM = x[1] * x[1];
+    for (i = 1; i < m; i++)
+        x[i] = (x[2U * i] * x[2U * i] + x[2U * i + 1U] * x[2U * i + 1U]) * spectrumPowerScale;
+    x[0] = p0 * spectrumPowerScale * 0.5f;
+    x[m] = pM * spectrumPowerScale * 0.5f;
+    spectrumAnalyzed = true;
+
+    // Fundamental
+    peak = (uint16_t)first;
+    for (i = (uint16_t)first; i <= m; i++)
+    {
+        if (x[i] > x[peak])
+            peak = i;
+    }
+    signal = AdcSpectrumLobe(x, peak, first, m, &bins);
+    usedBins = bins;
+    centres[0] = peak;
+
+    centroid = 0.0f;
+    weight = 0.0f;
+    for (k = (int32_t)peak - (int32_t)ADC_SPECTRUM_LOBE_BINS;
+         k <= (int32_t)peak + (int32_t)ADC_SPECTRUM_LOBE_BINS; k++)
+    {
+        if ((k >= first) && (k <= (int32_t)m))
+        {
+            centroid += (float)k * x[k];
+            weight += x[k];
+        }
+    }
+    centroid = (weight > 0.0f) ? (centroid / weight) : (float)peak;
+
+    // Harmonics 2..ADC_SPECTRUM_HARMONICS + 1, folded into 0..M
+    harmonics = 0.0f;
+    for (h = 2; h <= ADC_SPECTRUM_HARMONICS + 1U; h++)
+    {
+        float f = fmodf((float)h * centroid, (float)n);
+        int32_t c;
+        bool overlaps = false;
+        uint16_t j;
+
+        if (f > (float)m)
+            f = (float)n - f;
+        c = (int32_t)(f + 0.5f);
+
+        if (c < first + (int32_t)ADC_SPECTRUM_LOBE_BINS)
+            overlaps = true;
+        for (j = 0; j < numCentres; j++)
+        {
+            if (AdcSpectrumDistance(c, centres[j]) <= 2 * (int32_t)ADC_SPECTRUM_LOBE_BINS)
+                overlaps = true;
+        }
+        if (overlaps)
+            continue;
+
+        harmonics += AdcSpectrumLobe(x, c, first, m, &bins);
+        usedBins += bins;
+        centres[numCentres++] = c;
+    }
+
+    // Noise: bins outside DC and the tones, summed directly (a difference of
+    // totals would cancel below float resolution), extended over all bins
+    noise = 0.0f;
+    for (i = (uint16_t)first; i <= m; i++)
+    {
+        bool tone = false;
+        uint16_t j;
+
+        for (j = 0; j < numCentres; j++)
+        {
+            if (AdcSpectrumDistance(i, centres[j]) <= (int32_t)ADC_SPECTRUM_LOBE_BINS)
+                tone = true;
+        }
+        if (!tone)
+            noise += x[i];
+    }
+    if (usedBins < (uint16_t)(m + 1U - first))
+        noise *= (float)m / (float)(m + 1U - first - usedBins);
+
+    // Largest spur outside DC and the fundamental lobe
+    spur = 0.0f;
+    for (i = (uint16_t)first; i <= m; i++)
+    {
+        if ((AdcSpectrumDistance(i, peak) > (int32_t)ADC_SPECTRUM_LOBE_BINS) && (x[i] > spur))
+            spur = x[i];
+    }
+
+    out->points = n;
+    out->peakBin = peak;
+    out->fundamentalHz = (sampleRateHz > 0.0f) ? (centroid * sampleRateHz / (float)n) : centroid;
+    out->signalRms = sqrtf(signal);
+    out->signalDbfs = 10.0f * log10f(signal / (fullScaleCodes * fullScaleCodes / 8.0f) + 1e-30f);
+    out->snrDb = 10.0f * log10f(signal / (noise + 1e-30f));
+    out->sinadDb = 10.0f * log10f(signal / (noise + harmonics + 1e-30f));
+    out->thdDb = 10.0f * log10f((harmonics + 1e-30f) / signal);
+    out->sfdrDb = 10.0f * log10f(x[peak] / (spur + 1e-30f));
+    out->enob = 3.32192809f * log10f(fullScaleCodes /
+                                     (sqrtf((noise + harmonics) * 12.0f) + 1e-30f));
+
+    return true;
+}
+
+/**
+ * @brief Returns the one-sided power spectrum of the last analyzed record.
+ *
+ * @param bins Receives the number of bins.
+ * @return First bin.
+ */
+const float *AdcSpectrumGetPower(uint16_t *bins)
+{
+    *bins = spectrumAnalyzed ? (spectrumPoints / 2U + 1U) : 0U;
+    return spectrumBuffer;
+}
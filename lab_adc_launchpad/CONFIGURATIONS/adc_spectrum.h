@@ -0,0 +1,135 @@
+/**
+ * @file adc_spectrum.h
+ * @brief Header file for FFT-based dynamic performance metrics.
+ *
+ * This file contains definitions and function declarations for the FFT-based
+ * SNR, SINAD, THD, SFDR and ENOB of one channel (IEEE 1241).
+ *
+ * Memory (sections -> F28379D GS RAM):
+ * - adcfftbuf: record / FFT work buffer, ADC_SPECTRUM_MAX_POINTS floats (RAMGS9_10)
+ * - adcfftwin: half window, ADC_SPECTRUM_MAX_POINTS / 2 floats (RAMGS11)
+ * - adcfftsin: quarter-wave sine, ADC_SPECTRUM_MAX_POINTS / 4 + 1 floats (RAMGS12)
+ *
+ * @date Created on: May 25, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_SPECTRUM_H_
+#define ADC_SPECTRUM_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Supported record lengths (powers of two).
+ */
+#define ADC_SPECTRUM_MIN_POINTS     256U
+#define ADC_SPECTRUM_MAX_POINTS     4096U
+
+/**
+ * @brief Bins on each side of a tone attributed to it (Blackman-Harris main
+ * lobe is +/-4 bins, plus one for margin). Also the DC exclusion width.
+ */
+#define ADC_SPECTRUM_LOBE_BINS      5U
+
+/**
+ * @brief Harmonics included in THD (2nd to (ADC_SPECTRUM_HARMONICS + 1)th).
+ */
+#define ADC_SPECTRUM_HARMONICS      9U
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Dynamic performance of one record.
+ *
+ * Powers are taken from the windowed one-sided spectrum; the noise of the
+ * bins taken by DC, the fundamental and the harmonics is replaced by the mean
+ * noise per bin. dB values of ratios are positive for SNR, SINAD and SFDR
+ * (dBc) and negative for THD (dBc).
+ */
+typedef struct
+{
+    uint16_t points;        //!< Record length
+    uint16_t peakBin;       //!< Bin of the fundamental peak
+    float fundamentalHz;    //!< Fundamental frequency (interpolated)
+    float signalRms;        //!< Fundamental RMS in codes
+    float signalDbfs;       //!< Fundamental level vs a full-scale sine
+    float snrDb;            //!< Signal to noise (harmonics excluded)
+    float sinadDb;          //!< Signal to noise and distortion
+    float thdDb;            //!< Harmonic distortion to signal
+    float sfdrDb;           //!< Fundamental to largest spur
+    float enob;             //!< log2(FSR / (NAD_rms * sqrt(12)))
+} AdcSpectrumResult;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Builds the twiddle and window tables and starts a new record.
+ *
+ * @param points Record length: power of two, ADC_SPECTRUM_MIN_POINTS to
+ *               ADC_SPECTRUM_MAX_POINTS.
+ * @return false if the length is not supported.
+ */
+bool AdcSpectrumInit(uint16_t points);
+
+/**
+ * @brief Appends codes of one channel to the record.
+ *
+ * Codes beyond the end of the record are ignored until the record has been
+ * analyzed.
+ *
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ * @return true if the record is full.
+ */
+bool AdcSpectrumCapture(const uint16_t *in, size_t n, size_t stride);
+
+/**
+ * @brief Returns true when the record is full and ready for analysis.
+ */
+bool AdcSpectrumReady(void);
+
+/**
+ * @brief Discards a partly captured record (e.g. after lost samples).
+ *
+ * A full or analyzed record is kept.
+ */
+void AdcSpectrumClear(void);
+
+/**
+ * @brief Analyzes the full record and starts a new one.
+ *
+ * Removes the mean, applies the window, runs the real FFT in place and
+ * computes the metrics from the power spectrum.
+ *
+ * @param fullScaleCodes Full-scale range in codes (2^bits).
+ * @param sampleRateHz Sample rate, for fundamentalHz (0 to report bins).
+ * @param out Receives the metrics.
+ * @return false if the record is not full.
+ */
+bool AdcSpectrumAnalyze(float fullScaleCodes, float sampleRateHz, AdcSpectrumResult *out);
+
+/**
+ * @brief Returns the one-sided power spectrum of the last analyzed record.
+ *
+ * Valid after AdcSpectrumAnalyze() until the next AdcSpectrumCapture():
+ * points / 2 + 1 bins, in codes^2 (mean square per bin).
+ *
+ * @param bins Receives the number of bins.
+ * @return First bin.
+ */
+const float *AdcSpectrumGetPower(uint16_t *bins);
+
+#endif /* ADC_SPECTRUM_H_ */
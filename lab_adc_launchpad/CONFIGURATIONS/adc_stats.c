@@ -0,0 +1,173 @@
+/**
+ * @file adc_stats.c
+ * @brief Streaming (Welford) statistics engine with merge.
+ *
+ * This file contains the Welford update and the exact merge of two partial
+ * results, so long runs do not lose precision in float32.
+ *
+ * @date Created on: Apr 20, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <math.h>
+#include "adc_stats.h"
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Clears the statistics.
+ *
+ * @param stats Statistics to reset.
+ */
+void AdcStatsReset(AdcStats *stats)
+{
+    stats->count = 0;
+    stats->mean = 0.0f;
+    stats->m2 = 0.0f;
+    stats->min = 0.0f;
+    stats->max = 0.0f;
+}
+
+/**
+ * @brief Adds one sample (Welford update).
+ *
+ * @param stats Statistics to update.
+ * @param x Sample.
+ */
+void AdcStatsUpdate(AdcStats *stats, float x)
+{
+    float delta;
+
+    if (stats->count == 0U)
+    {
+        stats->min = x;
+        stats->max = x;
+    }
+    else
+    {
+        if (x < stats->min) stats->min = x;
+        if (x > stats->max) stats->max = x;
+    }
+
+    stats->count++;
+    delta = x - stats->mean;
+    stats->mean += delta / (float)stats->count;
+    stats->m2 += delta * (x - stats->mean);
+}
+
+/**
+ * @brief Adds a block of samples (two-pass block statistics, then merge).
+ *
+ * @param stats Statistics to update.
+ * @param x Samples.
+ * @param n Number of samples.
+ */
+void AdcStatsUpdateBlock(AdcStats *stats, const float *x, size_t n)
+{
+    AdcStats block;
+    float sum = 0.0f;
+    float sumSq = 0.0f;
+    float vMin;
+    float vMax;
+    size_t i;
+
+    if (n == 0U)
+        return;
+
+    // Pass 1: mean, min, max
+    vMin = x[0];
+    vMax = x[0];
+    for (i = 0; i < n; i++)
+    {
+        float v = x[i];
+        sum += v;
+        if (v < vMin) vMin = v;
+        if (v > vMax) vMax = v;
+    }
+
+    block.count = (uint32_t)n;
+    block.mean = sum / (float)n;
+    block.min = vMin;
+    block.max = vMax;
+
+    // Pass 2: squared deviations from the block mean
+    for (i = 0; i < n; i++)
+    {
+        float d = x[i] - block.mean;
+        sumSq += d * d;
+    }
+    block.m2 = sumSq;
+
+    AdcStatsMerge(stats, &block);
+}
+
+/**
+ * @brief Merges the statistics of a disjoint set of samples into dst.
+ *
+ * @param dst Statistics to update.
+ * @param src Statistics to add (unchanged).
+ */
+void AdcStatsMerge(AdcStats *dst, const AdcStats *src)
+{
+    uint32_t count;
+    float delta;
+    float fracSrc;
+
+    if (src->count == 0U)
+        return;
+    if (dst->count == 0U)
+    {
+        *dst = *src;
+        return;
+    }
+
+    count = dst->count + src->count;
+    delta = src->mean - dst->mean;
+    fracSrc = (float)src->count / (float)count;
+
+    dst->mean += delta * fracSrc;
+    dst->m2 += src->m2 + delta * delta * (float)dst->count * fracSrc;
+    if (src->min < dst->min) dst->min = src->min;
+    if (src->max > dst->max) dst->max = src->max;
+    dst->count = count;
+}
+
+/**
+ * @brief Returns the mean (0 if empty).
+ */
+float AdcStatsMean(const AdcStats *stats)
+{
+    return stats->mean;
+}
+
+/**
+ * @brief Returns the sample variance (0 with fewer than two samples).
+ */
+float AdcStatsVariance(const AdcStats *stats)
+{
+    if (stats->count < 2U)
+        return 0.0f;
+
+    return stats->m2 / (float)(stats->count - 1U);
+}
+
+/**
+ * @brief Returns the sample standard deviation.
+ */
+float AdcStatsStdDev(const AdcStats *stats)
+{
+    return sqrtf(AdcStatsVariance(stats));
+}
+
+/**
+ * @brief Returns max - min (0 if empty).
+ */
+float AdcStatsPeakToPeak(const AdcStats *stats)
+{
+    return stats->max - stats->min;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file adc_stats.h
+ * @brief Header file for the streaming (Welford) statistics engine.
+ *
+ * This file contains definitions and function declarations for running
+ * statistics (mean, variance, min, max) that can be merged across blocks.
+ *
+ * @date Created on: Apr 20, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_STATS_H_
+#define ADC_STATS_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stddef.h>
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Running statistics of one signal.
+ *
+ * m2 is the sum of squared deviations from the mean; variance = m2 / (count - 1).
+ */
+typedef struct
+{
+    uint32_t count;     //!< Samples accumulated
+    float mean;         //!< Running mean
+    float m2;           //!< Sum of squared deviations from the mean
+    float min;          //!< Smallest sample
+    float max;          //!< Largest sample
+} AdcStats;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Clears the statistics.
+ *
+ * @param stats Statistics to reset.
+ */
+void AdcStatsReset(AdcStats *stats);
+
+/**
+ * @brief Adds one sample (Welford update).
+ *
+ * @param stats Statistics to update.
+ * @param x Sample.
+ */
+void AdcStatsUpdate(AdcStats *stats, float x);
+
+/**
+ * @brief Adds a block of samples (two-pass block statistics, then merge).
+ *
+ * @param stats Statistics to update.
+ * @param x Samples.
+ * @param n Number of samples.
+ */
+void AdcStatsUpdateBlock(AdcStats *stats, const float *x, size_t n);
+
+/**
+ * @brief Merges the statistics of a disjoint set of samples into dst.
+ *
+ * @param dst Statistics to update.
+ * @param src Statistics to add (unchanged).
+ */
+void AdcStatsMerge(AdcStats *dst, const AdcStats *src);
+
+/**
+ * @brief Returns the mean (0 if empty).
+ */
+float AdcStatsMean(const AdcStats *stats);
+
+/**
+ * @brief Returns the sample variance (0 with fewer than two samples).
+ */
+float AdcStatsVariance(const AdcStats *stats);
+
+/**
+ * @brief Returns the sample standard deviation.
+ */
+float AdcStatsStdDev(const AdcStats *stats);
+
+/**
+ * @brief Returns max - min (0 if empty).
+ */
+float AdcStatsPeakToPeak(const AdcStats *stats);
+
+#endif /* ADC_STATS_H_ */
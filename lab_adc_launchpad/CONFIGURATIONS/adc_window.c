@@ -0,0 +1,274 @@
+/**
+ * @file adc_window.c
+ * @brief Sliding-window statistics with O(1) mean and O(1) amortized min/max.
+ *
+ * Per code:
+ * - the code leaving the window (when full) is subtracted from the sums and
+ *   popped from the front of a deque if it is that deque's extreme;
+ * - the new code is added to the sums, and pushed on the back of each deque
+ *   after popping the entries it dominates (>= for the min deque, <= for the
+ *   max deque).
+ *
+ * Each code is pushed and popped at most once per deque, so the cost is O(1)
+ * amortized. The deques hold ring positions: within one window every
+ * position holds exactly one live code, so the code leaving the window is the
+ * deque front exactly when the front equals its position.
+ *
+ * The sums are integers and exact: n * sumSq - sum^2 <= 2^12 * 2^44 fits in
+ * 64 bits for windows up to ADC_WINDOW_MAX_LENGTH, so the variance is exact
+ * up to the final conversion.
+ *
+ * @date Created on: May 04, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "adc_window.h"
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+// Window storage pools, one GS RAM block each
+#pragma DATA_SECTION(windowPool0, "adcwindow0")
+static uint16_t windowPool0[ADC_WINDOW_POOL_WORDS];
+#pragma DATA_SECTION(windowPool1, "adcwindow1")
+static uint16_t windowPool1[ADC_WINDOW_POOL_WORDS];
+
+static uint16_t poolUsed0 = 0;      // Words allocated from windowPool0
+static uint16_t poolUsed1 = 0;      // Words allocated from windowPool1
+
+/*********************************************************************************
+ * Local Functions
+ *********************************************************************************/
+
+/**
+ * @brief Takes n contiguous words from the first pool with room for them.
+ */
+static uint16_t *AdcWindowAlloc(uint16_t n)
+{
+    uint16_t *p = NULL;
+
+    if ((uint32_t)poolUsed0 + n <= ADC_WINDOW_POOL_WORDS)
+    {
+        p = &windowPool0[poolUsed0];
+        poolUsed0 += n;
+    }
+    else if ((uint32_t)poolUsed1 + n <= ADC_WINDOW_POOL_WORDS)
+    {
+        p = &windowPool1[poolUsed1];
+        poolUsed1 += n;
+    }
+
+    return p;
+}
+
+/**
+ * @brief Returns the ring position at the back of a deque.
+ */
+static inline uint16_t AdcWindowDequeBack(const AdcWindowDeque *q, uint16_t length)
+{
+    uint16_t i = q->head + q->size - 1U;
+    return q->pos[(i >= length) ? (i - length) : i];
+}
+
+/**
+ * @brief Appends a ring position at the back of a deque.
+ */
+static inline void AdcWindowDequePush(AdcWindowDeque *q, uint16_t length, uint16_t pos)
+{
+    uint16_t i = q->head + q->size;
+    q->pos[(i >= length) ? (i - length) : i] = pos;
+    q->size++;
+}
+
+/**
+ * @brief Removes the front entry of a deque.
+ */
+static inline void AdcWindowDequePopFront(AdcWindowDeque *q, uint16_t length)
+{
+    q->head = (q->head + 1U == length) ? 0U : (q->head + 1U);
+    q->size--;
+}
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Releases all window storage (windows created before become invalid).
+ */
+void AdcWindowPoolReset(void)
+{
+    poolUsed0 = 0;
+    poolUsed1 = 0;
+}
+
+/**
+ * @brief Allocates the storage of a window from the GS RAM pools and clears it.
+ *
+ * @param window Window to create.
+ * @param length Window length in samples (1 to ADC_WINDOW_MAX_LENGTH).
+ * @return false if the length is invalid or the pools are exhausted.
+ */
+bool AdcWindowCreate(AdcWindow *window, uint16_t length)
+{
+    uint16_t *storage;
+
+    if ((length == 0U) || (length > ADC_WINDOW_MAX_LENGTH))
+        return false;
+
+    // One allocation for the ring and both deques, so a failure leaks nothing
+    storage = AdcWindowAlloc(3U * length);
+    if (storage == NULL)
+        return false;
+
+    window->codes = storage;
+    window->minQ.pos = storage + length;
+    window->maxQ.pos = storage + 2U * length;
+
+    window->length = length;
+    AdcWindowClear(window);
+
+    return true;
+}
+
+/**
+ * @brief Empties the window, keeping its storage and length.
+ *
+ * @param window Window to clear.
+ */
+void AdcWindowClear(AdcWindow *window)
+{
+    window->count = 0;
+    window->next = 0;
+    window->rsvd = 0;
+    window->sum = 0;
+    window->sumSq = 0;
+    window->minQ.head = 0;
+    window->minQ.size = 0;
+    window->maxQ.head = 0;
+    window->maxQ.size = 0;
+}
+
+/**
+ * @brief Slides the window by one code.
+ *
+ * @param window Window to update.
+ * @param code Newest raw code.
+ */
+void AdcWindowUpdate(AdcWindow *window, uint16_t code)
+{
+    uint16_t length = window->length;
+    uint16_t pos = window->next;
+    uint16_t *codes = window->codes;
+
+    // Oldest code leaves the window
+    if (window->count == length)
+    {
+        uint16_t old = codes[pos];
+        window->sum -= old;
+        window->sumSq -= (uint32_t)old * old;
+        if (window->minQ.pos[window->minQ.head] == pos)
+            AdcWindowDequePopFront(&window->minQ, length);
+        if (window->maxQ.pos[window->maxQ.head] == pos)
+            AdcWindowDequePopFront(&window->maxQ, length);
+    }
+    else
+    {
+        window->count++;
+    }
+
+    // Newest code enters the window
+    codes[pos] = code;
+    window->sum += code;
+    window->sumSq += (uint32_t)code * code;
+
+    while ((window->minQ.size > 0U) && (codes[AdcWindowDequeBack(&window->minQ, length)] >= code))
+        window->minQ.size--;
+    AdcWindowDequePush(&window->minQ, length, pos);
+
+    while ((window->maxQ.size > 0U) && (codes[AdcWindowDequeBack(&window->maxQ, length)] <= code))
+        window->maxQ.size--;
+    AdcWindowDequePush(&window->maxQ, length, pos);
+
+    window->next = (pos + 1U == length) ? 0U : (pos + 1U);
+}
+
+/**
+ * @brief Slides the window over a block of codes of one channel.
+ *
+ * @param window Window to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcWindowUpdateBlock(AdcWindow *window, const uint16_t *in, size_t n,
+                          size_t stride)
+{
+    size_t i;
+
+    for (i = 0; i < n; i++)
+        AdcWindowUpdate(window, in[i * stride]);
+}
+
+/**
+ * @brief Returns the smallest code in the window (0 if empty).
+ */
+uint16_t AdcWindowMin(const AdcWindow *window)
+{
+    if (window->minQ.size == 0U)
+        return 0;
+
+    return window->codes[window->minQ.pos[window->minQ.head]];
+}
+
+/**
+ * @brief Returns the largest code in the window (0 if empty).
+ */
+uint16_t AdcWindowMax(const AdcWindow *window)
+{
+    if (window->maxQ.size == 0U)
+        return 0;
+
+    return window->codes[window->maxQ.pos[window->maxQ.head]];
+}
+
+/**
+ * @brief Converts the window statistics to volts.
+ *
+ * m2 (codes) = (n * sumSq - sum^2) / n, with the numerator exact in 64 bits.
+ *
+ * @param window Window to read.
+ * @param slope Volts per code.
+ * @param intercept Volts at code 0.
+ * @param out Receives count, mean, m2, min and max in volts.
+ */
+void AdcWindowToVolts(const AdcWindow *window, float slope, float intercept,
+                      AdcStats *out)
+{
+    uint32_t n = window->count;
+    uint64_t sum = window->sum;
+    float vMin;
+    float vMax;
+
+    out->count = n;
+    if (n == 0U)
+    {
+        out->mean = 0.0f;
+        out->m2 = 0.0f;
+        out->min = 0.0f;
+        out->max = 0.0f;
+        return;
+    }
+
+    out->mean = (float)((double)sum / (double)n * (double)slope + (double)intercept);
+    out->m2 = (float)((double)((uint64_t)n * window->sumSq - sum * sum) / (double)n *
+                      (double)slope * (double)slope);
+
+    vMin = (float)AdcWindowMin(window) * slope + intercept;
+    vMax = (float)AdcWindowMax(window) * slope + intercept;
+    out->min = (slope >= 0.0f) ? vMin : vMax;
+    out->max = (slope >= 0.0f) ? vMax : vMin;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file adc_window.h
+ * @brief Header file for sliding-window statistics over raw ADC codes.
+ *
+ * This file contains definitions and function declarations for true sliding
+ * windows of configurable length. Each window keeps its codes in a ring
+ * buffer, integer running sums for an O(1) mean and variance, and two
+ * monotonic deques for O(1) amortized min/max, so a fresh windowed view is
+ * available after every sample at constant cost. Window storage is taken
+ * from pools in GS RAM (sections adcwindow0/adcwindow1 -> RAMGS4/RAMGS5).
+ *
+ * @date Created on: May 04, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef ADC_WINDOW_H_
+#define ADC_WINDOW_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "adc_stats.h"      // AdcStats (report format)
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Words in each of the two storage pools (one GS RAM block each).
+ *
+ * A window of length n takes 3 * n words from one pool: the code ring and the
+ * two deques.
+ */
+#define ADC_WINDOW_POOL_WORDS   4096U
+
+/**
+ * @brief Longest window (its three arrays must fit in one pool).
+ */
+#define ADC_WINDOW_MAX_LENGTH   (ADC_WINDOW_POOL_WORDS / 3U)
+
+/*********************************************************************************
+ * Types
+ *********************************************************************************/
+
+/**
+ * @brief Monotonic deque of ring positions (circular, capacity = window length).
+ */
+typedef struct
+{
+    uint16_t *pos;          //!< Ring positions, front = oldest
+    uint16_t head;          //!< Index of the front entry
+    uint16_t size;          //!< Entries in the deque
+} AdcWindowDeque;
+
+/**
+ * @brief Sliding window over the last `length` codes of one channel.
+ */
+typedef struct
+{
+    uint16_t *codes;        //!< Ring buffer of the codes in the window
+    uint16_t length;        //!< Window length in samples
+    uint16_t count;         //!< Codes currently in the window (<= length)
+    uint16_t next;          //!< Ring position of the next code
+    uint16_t rsvd;          //!< Padding
+    uint32_t sum;           //!< Sum of the codes in the window
+    uint64_t sumSq;         //!< Sum of the squared codes in the window
+    AdcWindowDeque minQ;    //!< Increasing codes: front is the minimum
+    AdcWindowDeque maxQ;    //!< Decreasing codes: front is the maximum
+} AdcWindow;
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Releases all window storage (windows created before become invalid).
+ */
+void AdcWindowPoolReset(void);
+
+/**
+ * @brief Allocates the storage of a window from the GS RAM pools and clears it.
+ *
+ * @param window Window to create.
+ * @param length Window length in samples (1 to ADC_WINDOW_MAX_LENGTH).
+ * @return false if the length is invalid or the pools are exhausted.
+ */
+bool AdcWindowCreate(AdcWindow *window, uint16_t length);
+
+/**
+ * @brief Empties the window, keeping its storage and length.
+ *
+ * @param window Window to clear.
+ */
+void AdcWindowClear(AdcWindow *window);
+
+/**
+ * @brief Slides the window by one code.
+ *
+ * @param window Window to update.
+ * @param code Newest raw code.
+ */
+void AdcWindowUpdate(AdcWindow *window, uint16_t code);
+
+/**
+ * @brief Slides the window over a block of codes of one channel.
+ *
+ * @param window Window to update.
+ * @param in First code of the channel.
+ * @param n Number of codes.
+ * @param stride Distance between consecutive codes in words.
+ */
+void AdcWindowUpdateBlock(AdcWindow *window, const uint16_t *in, size_t n,
+                          size_t stride);
+
+/**
+ * @brief Returns the smallest code in the window (0 if empty).
+ */
+uint16_t AdcWindowMin(const AdcWindow *window);
+
+/**
+ * @brief Returns the largest code in the window (0 if empty).
+ */
+uint16_t AdcWindowMax(const AdcWindow *window);
+
+/**
+ * @brief Converts the window statistics to volts.
+ *
+ * @param window Window to read.
+ * @param slope Volts per code.
+ * @param intercept Volts at code 0.
+ * @param out Receives count, mean, m2, min and max in volts.
+ */
+void AdcWindowToVolts(const AdcWindow *window, float slope, float intercept,
+                      AdcStats *out);
+
+#endif /* ADC_WINDOW_H_ */
@@ -0,0 +1,34 @@
+/**
+ * @file cycle_counter.c
+ * @brief Free-running SYSCLK cycle counter on CPU Timer 1.
+ *
+ * This file configures CPU Timer 1 (already clocked by SYSCTL_init()) as a
+ * free-running 32-bit counter used for timestamps and cycle measurements.
+ *
+ * @date Created on: Feb 16, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "cycle_counter.h"
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Starts CPU Timer 1 as a free-running down-counter at SYSCLK.
+ */
+void CycleCounterInit(void)
+{
+    CPUTimer_stopTimer(CYCLE_COUNTER_BASE);
+    CPUTimer_setPeriod(CYCLE_COUNTER_BASE, 0xFFFFFFFFUL);
+    CPUTimer_setPreScaler(CYCLE_COUNTER_BASE, 0U);
+    CPUTimer_disableInterrupt(CYCLE_COUNTER_BASE);
+    CPUTimer_setEmulationMode(CYCLE_COUNTER_BASE, CPUTIMER_EMULATIONMODE_RUNFREE);
+    CPUTimer_reloadTimerCounter(CYCLE_COUNTER_BASE);
+    CPUTimer_clearOverflowFlag(CYCLE_COUNTER_BASE);
+    CPUTimer_resumeTimer(CYCLE_COUNTER_BASE);
+}
@@ -0,0 +1,60 @@
+/**
+ * @file cycle_counter.h
+ * @brief Header file for the free-running SYSCLK cycle counter.
+ *
+ * This file contains definitions and function declarations for a 32-bit
+ * cycle counter built on CPU Timer 1. It is used to timestamp samples and to
+ * measure the cost of processing kernels in SYSCLK cycles.
+ *
+ * @date Created on: Feb 16, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef CYCLE_COUNTER_H_
+#define CYCLE_COUNTER_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include "driverlib.h"
+#include "device.h"
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief CPU timer used as the cycle counter (clocked by SYSCLK).
+ */
+#define CYCLE_COUNTER_BASE      CPUTIMER1_BASE
+
+/**
+ * @brief Counter frequency in Hz (one count per SYSCLK cycle).
+ */
+#define CYCLE_COUNTER_FREQ      DEVICE_SYSCLK_FREQ
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Starts CPU Timer 1 as a free-running down-counter at SYSCLK.
+ *
+ * The timer interrupt is left disabled. The counter wraps every 2^32 cycles
+ * (about 21 s at 200 MHz); differences of CycleCounterRead() values are
+ * wrap-safe with unsigned arithmetic.
+ */
+void CycleCounterInit(void);
+
+/**
+ * @brief Returns the number of SYSCLK cycles since CycleCounterInit().
+ *
+ * Inline so that benchmark start/stop reads cost only a few cycles.
+ */
+static inline uint32_t CycleCounterRead(void)
+{
+    // Timer counts down from 0xFFFFFFFF; invert for an increasing count
+    return 0xFFFFFFFFUL - CPUTimer_getTimerCount(CYCLE_COUNTER_BASE);
+}
+
+#endif /* CYCLE_COUNTER_H_ */
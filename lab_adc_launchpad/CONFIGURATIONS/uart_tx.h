@@ -0,0 +1,75 @@
+/**
+ * @file uart_tx.h
+ * @brief Header file for the interrupt-driven UART transmit queue.
+ *
+ * This file contains definitions and function declarations for a software
+ * transmit queue in front of the SCI TX FIFO, so report output does not keep
+ * the main loop from draining the sample buffers.
+ *
+ * @date Created on: Jul 13, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef UART_TX_H_
+#define UART_TX_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib.h"
+#include "device.h"
+#include "board.h"          // Include SysConfig generated header
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief SCI module behind the queue (SysConfig mySCI0) and its TX interrupt.
+ */
+#define UART_TX_BASE            mySCI0_BASE
+#define UART_TX_INT             INT_SCIA_TX
+#define UART_TX_ACK_GROUP       INTERRUPT_ACK_GROUP9
+
+/**
+ * @brief Characters held by the queue (must be a power of two).
+ *
+ * The queue lives in GS RAM (section uarttxbuf, RAMGS15), one character per
+ * word: about 180 ms of output at 115200 baud. A writer only waits for the
+ * part of a report that does not fit.
+ */
+#define UART_TX_BUFFER_SIZE     2048U
+#define UART_TX_BUFFER_MASK     (UART_TX_BUFFER_SIZE - 1U)
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Clears the queue and registers the SCI TX FIFO interrupt.
+ *
+ * Must be called after Board_init() (SysConfig sets up the SCI and its FIFO)
+ * and before the first UartTxWrite(). The FIFO interrupt is only enabled
+ * while the queue holds characters.
+ */
+void UartTxInit(void);
+
+/**
+ * @brief Queues one character, waiting only if the queue is full.
+ *
+ * @param c Character (low 8 bits are sent).
+ */
+void UartTxWrite(uint16_t c);
+
+/**
+ * @brief Waits until every queued character has left the TX FIFO.
+ */
+void UartTxFlush(void);
+
+/**
+ * @brief SCI TX FIFO ISR: refills the FIFO from the queue.
+ */
+__interrupt void UartTxISR(void);
+
+#endif /* UART_TX_H_ */
@@ -0,0 +1,174 @@
+/**
+ * @file cpu2_analysis.c
+ * @brief CPU2 block analysis: statistics, low-pass filtering, frequency and tones.
+ *
+ * Two passes per channel over the block in GS RAM:
+ * 1. mean, min and max of the converted voltages;
+ * 2. AC RMS around the mean, the one-pole low-pass filter (its state carries
+ *    over between blocks) and a count of mean crossings with hysteresis,
+ *    which gives the dominant frequency of a periodic input.
+ * The raw codes also feed a Goertzel bank per channel (adc_goertzel.c), whose
+ * blocks of fs / CPU2_TONE_BLOCKS_PER_SECOND samples span several DMA blocks;
+ * cpu2_main.c restarts them whenever CPU1 reports a lost block.
+ *
+ * @date Created on: Mar 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <math.h>
+#include "cpu2_analysis.h"
+
+/*********************************************************************************
+ * Local Variables
+ *********************************************************************************/
+static AdcIpcConfig analysisConfig;
+static float lowpassState[ADC_IPC_MAX_CHANNELS];
+static bool lowpassPrimed[ADC_IPC_MAX_CHANNELS];
+static AdcGoertzelBank toneBanks[ADC_IPC_MAX_CHANNELS];
+static const float toneFrequencies[CPU2_NUM_TONES] = CPU2_TONES_HZ;
+static bool tonesReady;
+
+/*********************************************************************************
+ * Code
+ *********************************************************************************/
+
+/**
+ * @brief Stores the block configuration and resets the filter states.
+ *
+ * @param config Block layout and conversion constants sent by CPU1.
+ */
+void Cpu2AnalysisInit(const AdcIpcConfig *config)
+{
+    uint32_t toneBlock;
+    uint16_t ch;
+
+    analysisConfig = *config;
+    if (analysisConfig.numChannels > ADC_IPC_MAX_CHANNELS)
+        analysisConfig.numChannels = ADC_IPC_MAX_CHANNELS;
+
+    for (ch = 0; ch < ADC_IPC_MAX_CHANNELS; ch++)
+    {
+        lowpassState[ch] = 0.0f;
+        lowpassPrimed[ch] = false;
+    }
+
+    toneBlock = analysisConfig.sampleRateHz / CPU2_TONE_BLOCKS_PER_SECOND;
+    tonesReady = (CPU2_NUM_TONES <= ADC_IPC_MAX_TONES);
+    for (ch = 0; ch < analysisConfig.numChannels; ch++)
+    {
+        tonesReady = tonesReady &&
+                     AdcGoertzelInit(&toneBanks[ch], toneFrequencies, CPU2_NUM_TONES,
+                                     (float)analysisConfig.sampleRateHz, toneBlock);
+    }
+}
+
+/**
+ * @brief Restarts the Goertzel blocks after a gap in the block stream.
+ */
+void Cpu2AnalysisRestartTones(void)
+{
+    uint16_t ch;
+
+    for (ch = 0; ch < analysisConfig.numChannels; ch++)
+        AdcGoertzelClear(&toneBanks[ch]);
+}
+
+/**
+ * @brief Analyzes one block of interleaved raw codes.
+ *
+ * @param block First word of the block (numSamples rows of numChannels codes).
+ * @param numSamples Number of rows.
+ * @param results Receives the per-channel results (sequence/cycles untouched).
+ */
+void Cpu2AnalyzeBlock(const uint16_t *block, uint16_t numSamples,
+                      AdcIpcResults *results)
+{
+    uint16_t stride = analysisConfig.numChannels;
+    uint16_t ch;
+    uint16_t i;
+    uint16_t k;
+
+    results->numSamples = numSamples;
+    for (k = 0; k < ADC_IPC_MAX_TONES; k++)
+        results->toneHz[k] = (tonesReady && (k < CPU2_NUM_TONES)) ? toneFrequencies[k] : 0.0f;
+    results->tonesValid = 0U;
+    if (numSamples == 0U)
+        return;
+
+    for (ch = 0; ch < stride; ch++)
+    {
+        AdcIpcChannelResult *out = &results->channel[ch];
+        const uint16_t *code = &block[ch];
+        float midScale = analysisConfig.midScale[ch];
+        float scale = analysisConfig.scale[ch];
+        float sum = 0.0f;
+        float sumSq = 0.0f;
+        float vMin = ((float)code[0] - midScale) * scale;
+        float vMax = vMin;
+        float mean;
+        float y;
+        uint32_t crossings = 0;
+        int16_t side = 0;       // -1 below, +1 above mean (outside hysteresis)
+
+        // Pass 1: mean, min, max
+        for (i = 0; i < numSamples; i++)
+        {
+            float v = ((float)code[(uint32_t)i * stride] - midScale) * scale;
+            sum += v;
+            if (v < vMin) vMin = v;
+            if (v > vMax) vMax = v;
+        }
+        mean = sum / (float)numSamples;
+
+        // Pass 2: AC RMS, low-pass filter, mean crossings
+        y = lowpassPrimed[ch] ? lowpassState[ch] : mean;
+        for (i = 0; i < numSamples; i++)
+        {
+            float v = ((float)code[(uint32_t)i * stride] - midScale) * scale;
+            float ac = v - mean;
+
+            sumSq += ac * ac;
+            y += CPU2_LOWPASS_ALPHA * (v - y);
+
+            if ((ac > CPU2_CROSSING_HYST_V) && (side <= 0))
+            {
+                if (side < 0) crossings++;
+                side = 1;
+            }
+            else if ((ac < -CPU2_CROSSING_HYST_V) && (side >= 0))
+            {
+                if (side > 0) crossings++;
+                side = -1;
+            }
+        }
+        lowpassState[ch] = y;
+        lowpassPrimed[ch] = true;
+
+        out->mean = mean;
+        out->min = vMin;
+        out->max = vMax;
+        out->rmsAc = sqrtf(sumSq / (float)numSamples);
+        out->filtered = y;
+
+        // Two crossings per period
+        out->frequencyHz = (float)crossings * 0.5f *
+                           (float)analysisConfig.sampleRateHz / (float)numSamples;
+
+        // Tones of the last complete Goertzel block (codes to volts)
+        if (tonesReady)
+            AdcGoertzelUpdateBlock(&toneBanks[ch], code, numSamples, stride);
+        for (k = 0; k < ADC_IPC_MAX_TONES; k++)
+        {
+            bool have = tonesReady && (k < CPU2_NUM_TONES) && (toneBanks[ch].blocks > 0U);
+
+            out->toneAmplitude[k] = have ? toneBanks[ch].result[k].amplitude * fabsf(scale) : 0.0f;
+            out->tonePhaseDeg[k] = have ? toneBanks[ch].result[k].phaseDeg : 0.0f;
+        }
+    }
+
+    // All banks are fed the same rows, so channel 0 stands for all
+    results->tonesValid = (tonesReady && (toneBanks[0].blocks > 0U)) ? 1U : 0U;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file cpu2_analysis.h
+ * @brief Header file for the CPU2 block analysis (statistics, filter, tones).
+ *
+ * This file contains definitions and function declarations for the
+ * processing that CPU2 runs on every block received from CPU1.
+ *
+ * @date Created on: Mar 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+#ifndef CPU2_ANALYSIS_H_
+#define CPU2_ANALYSIS_H_
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_ipc.h"        // AdcIpcConfig, AdcIpcResults
+#include "adc_goertzel.h"   // Tone tracking
+
+/*********************************************************************************
+ * Defines
+ *********************************************************************************/
+/**
+ * @brief Smoothing factor of the one-pole low-pass filter (0 < alpha <= 1).
+ *
+ * y += alpha * (x - y); 0.05 gives a time constant of about 20 samples.
+ */
+#define CPU2_LOWPASS_ALPHA      0.05f
+
+/**
+ * @brief Hysteresis around the mean for the crossing counter, in volts.
+ *
+ * Keeps noise on a flat input from being counted as a signal.
+ */
+#define CPU2_CROSSING_HYST_V    0.01f
+
+/**
+ * @brief Tones tracked on every channel by the Goertzel banks, in Hz.
+ *
+ * At most ADC_IPC_MAX_TONES entries (CPU2_NUM_TONES).
+ */
+#define CPU2_TONES_HZ           { 50.0f, 60.0f }
+#define CPU2_NUM_TONES          2U
+
+/**
+ * @brief Goertzel blocks per second: fs / 5 holds whole periods of 50 and 60 Hz.
+ */
+#define CPU2_TONE_BLOCKS_PER_SECOND     5U
+
+/*********************************************************************************
+ * Functions
+ *********************************************************************************/
+
+/**
+ * @brief Stores the block configuration and resets the filter states.
+ *
+ * Tone tracking stays off (toneHz 0 in the results) if CPU2_TONES_HZ does
+ * not suit the sample rate.
+ *
+ * @param config Block layout and conversion constants sent by CPU1.
+ */
+void Cpu2AnalysisInit(const AdcIpcConfig *config);
+
+/**
+ * @brief Restarts the Goertzel blocks after a gap in the block stream.
+ *
+ * The tones are reported unavailable (tonesValid 0) until a block completes
+ * on clean data.
+ */
+void Cpu2AnalysisRestartTones(void);
+
+/**
+ * @brief Analyzes one block of interleaved raw codes.
+ *
+ * @param block First word of the block (numSamples rows of numChannels codes).
+ * @param numSamples Number of rows.
+ * @param results Receives the per-channel results (sequence/cycles untouched).
+ */
+void Cpu2AnalyzeBlock(const uint16_t *block, uint16_t numSamples,
+                      AdcIpcResults *results);
+
+#endif /* CPU2_ANALYSIS_H_ */
@@ -0,0 +1,158 @@
+/**
+ * @file cpu2_main.c
+ * @brief CPU2 firmware: analysis of the sample blocks acquired by CPU1.
+ *
+ * CPU1 does acquisition only (ePWM-paced ADCs, DMA ping-pong blocks) and hands
+ * each finished block to CPU2 over IPC (protocol in adc_ipc.h). CPU2 runs
+ * statistics, low-pass filtering, frequency estimation and Goertzel tone
+ * tracking on the block and returns the results through CPU2-to-CPU1 message
+ * RAM.
+ *
+ * Build: CCS project in this folder (lab_adc_launchpad_cpu2, CPU2_FLASH) with
+ * the CPU2 predefined symbol, 2837xD_FLASH_lnk_cpu2.cmd, device/ and
+ * CONFIGURATIONS/ on the include path, and device.c,
+ * F2837xD_CodeStartBranch.asm, cycle_counter.c and adc_goertzel.c linked in.
+ * Load it into the CPU2 flash; the CPU1 _FLASH build boots it with
+ * Device_bootCPU2() (AdcDualCoreInit()).
+ *
+ * @date Created on: Mar 23, 2026
+ * @author Hammad Iftikhar Hanif
+ */
+
+/*********************************************************************************
+ * Includes
+ *********************************************************************************/
+#include "driverlib.h"
+#include "device.h"
+#include "adc_ipc.h"         // Shared protocol
+#include "cycle_counter.h"   // Processing time per block
+#include "cpu2_analysis.h"   // Block analysis
+
+/*********************************************************************************
+ * Global Variables
+ *********************************************************************************/
+// Results in CPU2-to-CPU1 message RAM (readable by CPU1)
+#pragma DATA_SECTION(adcIpcResults, "adcIpcResults")
+AdcIpcResults adcIpcResults;
+
+AdcIpcResults blockResults;             // Working copy for the current block
+uint32_t blocksAnalyzed = 0;            // Blocks analyzed since start-up
+uint32_t blocksOverwritten = 0;         // Blocks refilled by the DMA during analysis
+uint32_t toneEpoch = 0;                 // Overrun epoch the Goertzel blocks started in
+
+// Configuration in CPU1-to-CPU2 message RAM (overrun epoch updated by CPU1)
+const volatile AdcIpcConfig *ipcConfig;
+
+/*********************************************************************************
+ * Function Prototypes
+ *********************************************************************************/
+void WaitForConfig(void);
+
+/*********************************************************************************
+ * Main Function
+ *********************************************************************************/
+void main(void)
+{
+    uint32_t command;
+    uint32_t addr;
+    uint32_t data;
+    uint32_t start;
+    uint32_t epoch;
+
+    //
+    // Initialize device (CPU2: no clock or flash setup, done by CPU1)
+    //
+    Device_init();
+    
+    //
+    // Initialize PIE and clear PIE registers
+    //
+    Interrupt_initModule();
+    Interrupt_initVectorTable();
+    
+    IPC_init(IPC_CPU2_L_CPU1_R);
+    CycleCounterInit();
+    
+    EINT;
+    ERTM;
+    
+    //
+    // Handshake with CPU1, then receive the block configuration
+    //
+    IPC_sync(IPC_CPU2_L_CPU1_R, ADC_IPC_FLAG_SYNC);
+    WaitForConfig();
+    
+    //
+    // Main loop: analyze every block handed over by CPU1
+    //
+    while(1)
+    {
+        if (!IPC_readCommand(IPC_CPU2_L_CPU1_R, ADC_IPC_FLAG_BLOCK,
+                             IPC_ADDR_CORRECTION_DISABLE, &command, &addr, &data))
+            continue;
+        
+        if (command == ADC_IPC_CMD_BLOCK)
+        {
+            // A block was lost since the Goertzel blocks started: restart them
+            epoch = ipcConfig->overrunEpoch;
+            if (epoch != toneEpoch)
+            {
+                Cpu2AnalysisRestartTones();
+                toneEpoch = epoch;
+            }
+            
+            start = CycleCounterRead();
+            Cpu2AnalyzeBlock((const uint16_t *)addr, (uint16_t)data, &blockResults);
+            blockResults.cycles = CycleCounterRead() - start;
+            blockResults.sequence = ++blocksAnalyzed;
+            
+            // CPU1 dropped a block meanwhile: the DMA refilled this one (and
+            // the tones restart with the next block, as the epoch changed)
+            blockResults.valid = (ipcConfig->overrunEpoch == epoch) ? 1U : 0U;
+            if (!blockResults.valid)
+                blocksOverwritten++;
+            blockResults.overwritten = blocksOverwritten;
+        }
+        
+        // Block released: CPU1 may send the next one
+        IPC_ackFlagRtoL(IPC_CPU2_L_CPU1_R, ADC_IPC_FLAG_BLOCK);
+        
+        // Publish only after CPU1 has consumed the previous results
+        if ((command == ADC_IPC_CMD_BLOCK) &&
+            !IPC_isFlagBusyLtoR(IPC_CPU2_L_CPU1_R, ADC_IPC_FLAG_RESULT))
+        {
+            adcIpcResults = blockResults;
+            IPC_sendCommand(IPC_CPU2_L_CPU1_R, ADC_IPC_FLAG_RESULT,
+                            IPC_ADDR_CORRECTION_DISABLE, ADC_IPC_CMD_RESULT,
+                            (uint32_t)&adcIpcResults, blockResults.sequence);
+        }
+    }
+}
+
+/*********************************************************************************
+ * Function Implementations
+ *********************************************************************************/
+
+/**
+ * @brief Waits for ADC_IPC_CMD_CONFIG from CPU1 and initializes the analysis
+ */
+void WaitForConfig(void)
+{
+    uint32_t command = 0;
+    uint32_t addr;
+    uint32_t data;
+    
+    while (command != ADC_IPC_CMD_CONFIG)
+    {
+        if (IPC_readCommand(IPC_CPU2_L_CPU1_R, ADC_IPC_FLAG_BLOCK,
+                            IPC_ADDR_CORRECTION_DISABLE, &command, &addr, &data))
+        {
+            if (command == ADC_IPC_CMD_CONFIG)
+            {
+                ipcConfig = (const volatile AdcIpcConfig *)addr;
+                Cpu2AnalysisInit((const AdcIpcConfig *)addr);
+            }
+            IPC_ackFlagRtoL(IPC_CPU2_L_CPU1_R, ADC_IPC_FLAG_BLOCK);
+        }
+    }
+}
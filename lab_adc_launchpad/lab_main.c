@@ -9,6 +9,10 @@
  *
  * Note: ADCINB0 is not available on LaunchPad, using ADCINB2 instead
  *
+ * Acquisition is paced by ePWM1 SOCA (ACQUISITION_MODE). Samples reach the
+ * main loop either through the ADCA1 ISR ring buffer or as finished DMA
+ * ping-pong blocks, and are drained into the statistics.
+ *
  * Hardware Requirements:
  * - LaunchPad F28379D
  * - UART connection for results output (SCI-A, GPIO28/29)
@@ -30,6 +34,30 @@
 #include "device.h"
 #include "board.h"           // SysConfig generated
 #include "adc_config.h"      // ADC functions
+#include "adc_acquisition.h" // ePWM-paced acquisition
+#include "adc_dma.h"         // DMA ping-pong capture
+#include "adc_simultaneous.h" // Shared-trigger sampling, skew check
+#include "adc_oversample.h"  // Chained-SOC oversampling
+#include "adc_scan.h"        // Burst-mode scan, ADCA..ADCD
+#include "adc_freerun.h"     // Continuous conversion, overflow accounting
+#include "adc_cla.h"         // CLA-offloaded conversion and statistics
+#include "adc_dualcore.h"    // CPU2 block analysis over IPC
+#include "adc_fixed.h"       // Q24 integer conversion and statistics
+#include "adc_calibration.h" // Two-point gain/offset calibration
+#include "adc_stats.h"       // Streaming (Welford) statistics
+#include "adc_codestats.h"   // Integer raw-code statistics
+#include "adc_window.h"      // Sliding-window statistics
+#include "adc_histogram.h"   // Code-density histograms
+#include "adc_quantile.h"    // Streaming (P-square) quantiles
+#include "adc_spectrum.h"    // FFT dynamic performance (SNR, ENOB)
+#include "adc_goertzel.h"    // Tone tracking (mains, excitation)
+#include "adc_decimator.h"   // CIC + compensation-FIR decimation
+#include "adc_fir.h"         // Block-processing polyphase FIR filters
+#include "adc_biquad.h"      // Cascaded biquad IIR filters (DF2T)
+#include "adc_smooth.h"      // O(1) moving-average and EMA smoothing
+#include "adc_median.h"      // Streaming median / Hampel spike rejection
+#include "cycle_counter.h"   // Conversion path benchmark
+#include "uart_tx.h"         // Interrupt-driven UART output
 #include <string.h>
 #include <math.h>
 
@@ -38,20 +66,159 @@
  *********************************************************************************/
 #define LED_GPIO        31              // Blue LED on LaunchPad
 #define TEST_ITERATIONS 10              // Stats display interval
-#define UART_BASE       mySCI0_BASE     // From SysConfig (SCIA)
+
+// Acquisition modes
+#define ACQ_MODE_POLLED         0       // ADC_forceSOC + polling (AdcConversion)
+#define ACQ_MODE_EPWM           1       // ePWM-paced ADCA1 ISR + ring buffer
+#define ACQ_MODE_DMA            2       // ePWM-paced DMA ping-pong blocks
+#define ACQ_MODE_OVERSAMPLE     3       // Chained-SOC oversampling, forced SOCs
+#define ACQ_MODE_SCAN           4       // ePWM-paced burst scan on all four ADCs
+#define ACQ_MODE_FREERUN        5       // ADCINT1 re-triggered SOCs, maximum rate
+#define ACQ_MODE_CLA            6       // ePWM-paced, ADCINT1 -> CLA task statistics
+#define ACQ_MODE_DUALCORE       7       // DMA blocks analyzed by CPU2 (CPU2/ image)
+#define ACQUISITION_MODE        ACQ_MODE_EPWM
+#define ACQ_SAMPLE_RATE_HZ      10000UL // ePWM sample rate (up to ADC_ACQ_MAX_RATE_HZ)
+#define SKEW_TEST_TRIGGERS      100     // Shared triggers for the skew self-test
+#define OVERSAMPLE_LOG2         4       // 16 SOCs per reading (ACQ_MODE_OVERSAMPLE)
+#define OVERSAMPLE_EXTRA_BITS   2       // 16x oversampling -> +2 bits
+#define SCAN_FRAME_RATE_HZ      1000UL  // Scan frames/s (up to ADC_SCAN_MAX_FRAME_RATE_HZ)
+#define STATS_PATH_FLOAT        0       // Calibrated float volts, Welford per sample
+#define STATS_PATH_Q24          1       // Integer Q24 volts, integer min/max/sum
+#define STATS_PATH_CODES        2       // Raw codes, integer sums; volts at report time
+#define STATISTICS_PATH         STATS_PATH_CODES    // Path for sampled data
+#define BENCH_SAMPLES           1000U   // Samples per conversion path benchmark
+#define BLOCK_CHUNK_SAMPLES     64U     // Samples per block conversion call in ProcessBlock
+#define STATS_WINDOW_SAMPLES    1024U   // Sliding window length (3 words/sample in RAMGS4-5)
+#define HIST_WINDOW_BINS_16BIT  2048U   // 16-bit channel histogram: codes around the start-up reading
+#define HISTOGRAM_EXPORT        0       // 1: send binary histogram frames after each statistics report
+#define NUM_QUANTILES           4       // Entries in quantileProbs[]
+#define SPECTRUM_POINTS         1024U   // FFT record length (256 to 4096), channels alternate
+#define NUM_TONES               3       // Entries in toneFrequencies[]
+#define TONE_BLOCKS_PER_SECOND  5U      // Goertzel block = fs / 5: whole periods of 50 and 60 Hz
+#define DECIM_OUT_SAMPLES       16U     // Decimator outputs handled per call
+#define FIR_TAPS                64U     // Low-pass FIR length (coefficients in RAMD1)
+#define FIR_DECIMATION          4U      // FIR output rate = fs / FIR_DECIMATION
+#define FIR_CUTOFF              0.1f    // FIR cut-off, fraction of fs (below 0.5 / FIR_DECIMATION)
+#define FIR_OUT_SAMPLES         16U     // FIR outputs handled per call
+#define BIQUAD_SET_HUM          0U      // 50 Hz + 60 Hz notches
+#define BIQUAD_SET_LOWPASS      1U      // 4th-order Butterworth low-pass
+#define NUM_BIQUAD_SETS         2U      // Coefficient sets in biquadSets[]
+#define BIQUAD_SECTIONS         2U      // Sections per coefficient set
+#define BIQUAD_NOTCH_Q          10.0f   // Notch quality factor (f0 / bandwidth)
+#define BIQUAD_LOWPASS_HZ       100.0f  // Low-pass cut-off
+#define DESPIKE_WIDTH           7U      // Median window (odd, 3 to 31)
+#define DESPIKE_MODE            ADC_MEDIAN_MODE_HAMPEL  // Or ADC_MEDIAN_MODE_MEDIAN
+#define DESPIKE_THRESHOLD       3.0f    // Hampel threshold (standard deviations)
+#define CALIBRATION_PROCEDURE   0       // 1: run the two-point calibration at start-up
+#define CAL_SAMPLES             1024U   // Conversions averaged per reference point
+#define CAL_SETTLE_US           10000000UL  // Time to apply each reference input
+#define CAL_LOW_FRACTION        0.1f    // Low reference, fraction of the input range
+#define CAL_HIGH_FRACTION       0.9f    // High reference, fraction of the input range
 
 /*********************************************************************************
  * Global Variables
  *********************************************************************************/
 uint16_t adcRawData[NUM_ADC_CHANNELS];   // Raw ADC readings
 float adcVoltages[NUM_ADC_CHANNELS];      // Converted voltages
+int32_t adcVoltagesQ24[NUM_ADC_CHANNELS]; // Converted voltages, Q24 (fixed-point path)
 uint32_t testIteration = 0;               // Test counter
+uint32_t acqSampleRate = 0;               // Actual ePWM sample rate (Hz)
+uint32_t samplesSinceReport = 0;          // Samples drained since last report
+
+// DMA block handoff (set by the DMA ISR callback, cleared by the main loop)
+const AdcSample * volatile dmaReadyBlock = NULL;
+volatile uint16_t dmaReadySamples = 0;
+volatile uint32_t dmaBlocksReplaced = 0;  // Blocks replaced before the main loop consumed them
+
+// Simultaneous sampling self-test
+AdcSkewResult skewResult;
+
+// Oversampled codes (native resolution + OVERSAMPLE_EXTRA_BITS)
+uint32_t adcOversampleCodes[NUM_ADC_CHANNELS];
+
+// Burst scan frame (ACQ_MODE_SCAN)
+AdcScanFrame scanFrame;
+float scanVoltages[ADC_SCAN_MAX_CHANNELS];
+uint32_t scanReportedSequence = 0;        // Frame number of the last report
+
+// Free-running capture report (ACQ_MODE_FREERUN)
+AdcFreeRunBlockInfo freeRunInfo;
+
+// CLA statistics window (ACQ_MODE_CLA)
+AdcClaStats claStats;
+
+// CPU2 analysis results (ACQ_MODE_DUALCORE)
+AdcIpcResults dualCoreResults;
 
 // Statistics
-float minVoltages[NUM_ADC_CHANNELS];
-float maxVoltages[NUM_ADC_CHANNELS];
-float avgVoltages[NUM_ADC_CHANNELS];
-float sumVoltages[NUM_ADC_CHANNELS];
+AdcStats channelStats[NUM_ADC_CHANNELS];  // Since the last InitStatistics
+AdcStats totalStats[NUM_ADC_CHANNELS];    // Since start-up (merged batches)
+bool statsHaveVariance = true;            // false: Q24 and CLA windows, std shows n/a
+AdcFixedStats fixedStats;                 // Integer statistics (STATS_PATH_Q24)
+AdcCodeStats codeStats[NUM_ADC_CHANNELS]; // Raw-code statistics (STATS_PATH_CODES)
+float blockVoltages[NUM_ADC_CHANNELS][BLOCK_CHUNK_SAMPLES];  // Block conversion chunk
+AdcWindow slidingWindows[NUM_ADC_CHANNELS];  // Last STATS_WINDOW_SAMPLES codes
+bool windowsReady = false;                // Window storage allocated
+AdcHistogram codeHistograms[NUM_ADC_CHANNELS];  // Code density since start-up
+bool histogramsReady = false;             // Histogram storage allocated
+const float quantileProbs[NUM_QUANTILES] = { 0.5f, 0.95f, 0.99f, 0.999f };
+AdcQuantile channelQuantiles[NUM_ADC_CHANNELS][NUM_QUANTILES];  // Codes since start-up
+bool spectrumReady = false;               // FFT tables built
+uint16_t spectrumChannel = 0;             // Channel captured into the FFT record
+AdcSpectrumResult spectrumResult;         // Metrics of the last record
+bool spectrumFresh = false;               // spectrumResult not displayed yet (capture paused)
+const float toneFrequencies[NUM_TONES] = { 50.0f, 60.0f, 1000.0f };  // Tracked tones (Hz)
+AdcGoertzelBank toneBanks[NUM_ADC_CHANNELS];  // Goertzel bank per channel
+bool tonesReady = false;                  // Banks set up for the sample rate
+const uint16_t decimationRatios[NUM_ADC_CHANNELS] = { 256U, 64U };  // Per channel (ADCA, ADCB)
+AdcDecimator decimators[NUM_ADC_CHANNELS];    // Low-rate, higher-resolution streams
+bool decimatorsReady = false;             // Decimators set up
+int32_t decimatedCodes[DECIM_OUT_SAMPLES];    // Decimator output chunk, Q8 codes
+AdcStats decimatedStats[NUM_ADC_CHANNELS];    // Decimated stream, since the last InitStatistics
+float decimatedLast[NUM_ADC_CHANNELS];    // Latest decimated value (V)
+float firPrototype[FIR_TAPS];             // Low-pass prototype, copied into the coefficient pool
+AdcFir firFilters[NUM_ADC_CHANNELS];      // Low-pass decimating FIR per channel
+bool firReady = false;                    // FIR filters set up
+float firOutput[FIR_OUT_SAMPLES];         // FIR output chunk (codes)
+AdcStats firStats[NUM_ADC_CHANNELS];      // Filtered stream, since the last InitStatistics
+float firLast[NUM_ADC_CHANNELS];          // Latest filtered value (V)
+AdcBiquadCoeffs biquadSets[NUM_BIQUAD_SETS][BIQUAD_SECTIONS];  // Designed for the sample rate
+uint16_t biquadChannelSet[NUM_ADC_CHANNELS] = { BIQUAD_SET_HUM, BIQUAD_SET_HUM };  // Runtime selectable
+AdcBiquadCascade biquads[NUM_ADC_CHANNELS];   // IIR cascade per channel
+bool biquadsReady = false;                // Sets designed for the sample rate
+float biquadOutput[BLOCK_CHUNK_SAMPLES];  // IIR block output chunk
+AdcStats biquadStats[NUM_ADC_CHANNELS];   // IIR output, since the last InitStatistics
+float biquadLast[NUM_ADC_CHANNELS];       // Latest IIR output (V)
+const uint16_t smoothLog2Length[NUM_ADC_CHANNELS] = { 6U, 4U };  // Moving average of 2^k samples
+const uint16_t smoothEmaShift[NUM_ADC_CHANNELS] = { 8U, 5U };    // EMA alpha = 2^-k
+AdcMovingAverage movingAverages[NUM_ADC_CHANNELS];    // Boxcar per channel
+AdcEma emaFilters[NUM_ADC_CHANNELS];      // EMA per channel
+bool smoothingReady = false;              // Smoothers set up
+AdcMedian despikeFilters[NUM_ADC_CHANNELS];   // Median / Hampel per channel
+bool despikeReady = false;                // Spike filters set up
+uint16_t despikedCodes[BLOCK_CHUNK_SAMPLES];  // Spike filter output chunk
+AdcStats despikedStats[NUM_ADC_CHANNELS]; // Spike-filtered stream, since the last InitStatistics
+uint32_t streamGaps = 0;                  // Ring gaps the stream stages restarted after
+
+// Conversion path benchmark (kept off the stack)
+uint16_t benchCodes[BLOCK_CHUNK_SAMPLES]; // Constant input chunk
+AdcBiquadCoeffs benchSet[BIQUAD_SECTIONS];    // Notch cascade for the nominal rate
+AdcBiquadCascade benchCascade;            // Cascade running benchSet
+uint32_t benchFloatCycles;                // Float conversion + statistics
+uint32_t benchFixedCycles;                // Q24 conversion + statistics
+uint32_t benchCodeCycles;                 // Raw-code statistics
+uint32_t benchBlockCycles;                // AdcCalResultBlock()
+uint32_t benchBlockSamples;               // Codes converted by the block path
+uint32_t benchQuantileCycles;             // P2 quantile updates
+uint32_t benchQuantileMaxCycles;          // Worst sample of the quantile updates
+uint32_t benchFirCycles;                  // FIR block path
+uint32_t benchFirTaps;                    // Coefficients applied by the FIR path
+uint32_t benchBiquadCycles;               // Biquad step path
+uint32_t benchBiquadMaxCycles;            // Worst sample of the biquad step path
+uint32_t benchBiquadBlockCycles;          // Biquad block path
+uint32_t benchSmoothCycles;               // Moving average + EMA
+uint32_t benchMedianCycles[2];            // Median and Hampel, per width
+uint32_t benchMedianMaxCycles[2];         // Worst sample, median and Hampel
 
 /*********************************************************************************
  * Function Prototypes
@@ -62,12 +229,50 @@ void UARTSendChar(char c);
 void UARTSendInt(int32_t num);
 void UARTSendUInt(uint32_t num);
 void UARTSendFloat(float value);
+void UARTSendHex16(uint16_t value);
 void InitStatistics(void);
 void UpdateStatistics(void);
 void DisplayHeader(void);
 void DisplayReadings(void);
 void DisplayStatistics(void);
 bool VerifyADCReadings(void);
+void DmaBlockReady(const AdcSample *block, uint16_t numSamples);
+void ProcessBlock(const AdcSample *block, uint16_t numSamples);
+void DisplaySkewResult(void);
+void DisplayScanFrame(void);
+void LoadClaStatistics(void);
+void DisplayDualCoreResults(void);
+void ConvertAndAccumulate(void);
+void InitWindows(void);
+void DisplayWindows(void);
+void InitHistograms(void);
+void DisplayHistograms(void);
+void InitQuantiles(void);
+void UpdateQuantiles(void);
+void DisplayQuantiles(void);
+void AnalyzeSpectrum(void);
+void DisplaySpectrum(void);
+void InitTones(uint32_t sampleRateHz);
+void DisplayTones(void);
+void InitDecimators(void);
+void DecimateCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride);
+void DisplayDecimated(void);
+void InitFilters(void);
+void FilterCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride);
+void DisplayFilters(void);
+void InitBiquads(uint32_t sampleRateHz);
+void BiquadCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride);
+void DisplayBiquads(void);
+void InitSmoothing(void);
+void GetSmoothedVolts(uint16_t ch, float *maVolts, float *emaVolts);
+void InitDespike(void);
+void DespikeCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride);
+void DisplayDespiked(void);
+void ResetStreamStages(void);
+void UARTSendByte(uint16_t byte);
+void LoadDeferredStatistics(void);
+void BenchmarkConversionPaths(void);
+void RunCalibration(void);
 
 /*********************************************************************************
  * Main Function
@@ -99,6 +304,17 @@ void main(void)
     //
     Board_init();
     
+    //
+    // UART output through a queue drained by the SCI TX FIFO interrupt, so
+    // reports do not stall the sample buffers
+    //
+    UartTxInit();
+    
+    //
+    // Post-processing blocks: offset removal and limit detection in hardware
+    //
+    AdcPpbInit();
+    
     //
     // Initialize status LED
     //
@@ -120,12 +336,20 @@ void main(void)
     //
     DEVICE_DELAY_US(10000);
     
+    //
+    // Per-board calibration from the reserved flash section
+    //
+    if (AdcCalInit())
+        UARTSendString(">>> Calibration: loaded from flash\r\n");
+    else
+        UARTSendString(">>> Calibration: none stored, ideal constants\r\n");
+    
     //
     // Run initial ADC test
     //
     UARTSendString("\r\n>>> Running ADC Initialization Test...\r\n");
     AdcConversion(adcRawData);
-    AdcResult(adcVoltages, adcRawData);
+    AdcCalPpbResult(adcVoltages);
     
     if (VerifyADCReadings())
     {
@@ -141,6 +365,38 @@ void main(void)
         UARTSendString("    Note: This is OK for floating inputs\r\n");
     }
     
+#if CALIBRATION_PROCEDURE
+    RunCalibration();
+#endif
+    
+    //
+    // Verify that one shared trigger samples ADCA and ADCB together
+    //
+    AdcSimultaneousInit();
+    AdcSimultaneousMeasureSkew(SKEW_TEST_TRIGGERS, &skewResult);
+    DisplaySkewResult();
+    
+    //
+    // Sliding windows over the latest samples
+    //
+    InitWindows();
+    InitHistograms();
+    InitQuantiles();
+    InitDecimators();
+    InitFilters();
+    InitSmoothing();
+    InitDespike();
+    spectrumReady = AdcSpectrumInit(SPECTRUM_POINTS);
+    if (!spectrumReady)
+        UARTSendString(">>> Spectrum: SPECTRUM_POINTS not supported\r\n");
+    
+    //
+    // Compare the float, Q24 and raw-code statistics paths
+    //
+    if (!AdcFixedInit())
+        UARTSendString(">>> Fixed-point scale: OUT OF RANGE\r\n");
+    BenchmarkConversionPaths();
+    
     //
     // Initialize statistics
     //
@@ -153,16 +409,305 @@ void main(void)
     UARTSendString(">>> Readings update every 1 second\r\n");
     UARTSendString(">>> Statistics every 10 readings\r\n\r\n");
     
+#if (ACQUISITION_MODE == ACQ_MODE_EPWM) || (ACQUISITION_MODE == ACQ_MODE_DMA)
+    //
+    // Hardware-paced acquisition: ePWM1 SOCA triggers both ADCs, the ADCA1
+    // ISR (or the DMA) fills the buffers and the main loop only drains them
+    //
+    acqSampleRate = AdcAcquisitionInit(ACQ_SAMPLE_RATE_HZ);
+    UARTSendString(">>> ePWM acquisition at ");
+    UARTSendUInt(acqSampleRate);
+    UARTSendString(" Hz\r\n\r\n");
+    InitTones(acqSampleRate);
+    InitBiquads(acqSampleRate);
+    
+#if (ACQUISITION_MODE == ACQ_MODE_DMA)
+    AdcDmaCaptureInit(DmaBlockReady);
+    AdcDmaCaptureStart();
+#else
+    AdcAcquisitionStart();
+#endif
+    
+    //
+    // Main test loop
+    //
+    while(1)
+    {
+#if (ACQUISITION_MODE == ACQ_MODE_DMA)
+        // Consume the last finished DMA block
+        if (dmaReadyBlock != NULL)
+        {
+            const AdcSample *block;
+            uint16_t numSamples;
+            
+            // Take the block with the DMA ISR masked, so none is lost uncounted
+            DINT;
+            block = dmaReadyBlock;
+            numSamples = dmaReadySamples;
+            dmaReadyBlock = NULL;
+            EINT;
+            ProcessBlock(block, numSamples);
+        }
+#else
+        // Consume every sample captured since the last pass
+        while (AdcAcquisitionRead(adcRawData))
+        {
+            ConvertAndAccumulate();
+            samplesSinceReport++;
+        }
+        
+        // Samples were lost after the ones just read: restart the filters
+        // that assume a continuous stream
+        if (AdcAcquisitionGetGaps() != streamGaps)
+        {
+            streamGaps = AdcAcquisitionGetGaps();
+            ResetStreamStages();
+        }
+#endif
+        
+        // Report once per second of acquired samples
+        if (samplesSinceReport < acqSampleRate)
+            continue;
+        samplesSinceReport = 0;
+        
+#if (STATISTICS_PATH != STATS_PATH_FLOAT)
+        LoadDeferredStatistics();
+#endif
+        
+        // Display latest readings
+        DisplayReadings();
+        
+        // Toggle LED
+        GPIO_togglePin(LED_GPIO);
+        
+        // Display statistics every 10 reports
+        if ((testIteration > 0) && (testIteration % TEST_ITERATIONS == 0))
+        {
+            DisplayStatistics();
+            InitStatistics();  // Reset for next batch
+        }
+        
+        // Increment counter
+        testIteration++;
+    }
+#elif (ACQUISITION_MODE == ACQ_MODE_SCAN)
+    //
+    // Burst scan: every ePWM1 SOCA pulse converts the channel list of all
+    // four ADCs. AdcScanInit() must follow AdcAcquisitionInit(), which would
+    // otherwise re-route SOC0 and the ADCA1 interrupt.
+    //
+    acqSampleRate = AdcAcquisitionInit(SCAN_FRAME_RATE_HZ);
+    if (!AdcScanInit(adcScanDefaultList, ADC_ACQ_EPWM_TRIGGER))
+        UARTSendString(">>> Scan list: INVALID channel count\r\n");
+    UARTSendString(">>> Burst scan at ");
+    UARTSendUInt(acqSampleRate);
+    UARTSendString(" frames/s\r\n\r\n");
+    
+    AdcAcquisitionStart();
+    
+    //
+    // Main test loop
+    //
+    while(1)
+    {
+        // Report the latest frame once per second of frames
+        if (!AdcScanReadFrame(&scanFrame))
+            continue;
+        if ((scanFrame.sequence - scanReportedSequence) < acqSampleRate)
+            continue;
+        scanReportedSequence = scanFrame.sequence;
+        
+        AdcScanResult(scanVoltages, &scanFrame);
+        DisplayScanFrame();
+        
+        // Toggle LED
+        GPIO_togglePin(LED_GPIO);
+        
+        // Increment counter
+        testIteration++;
+    }
+#elif (ACQUISITION_MODE == ACQ_MODE_FREERUN)
+    //
+    // Free-running: each converter re-triggers itself from ADCINT1 and runs
+    // back-to-back; blocks are captured by polling with overflow accounting
+    //
+    if (!AdcFreeRunInit())
+    {
+        UARTSendString(">>> Free-run: channels must be on separate converters\r\n");
+        while(1)
+        {
+        }
+    }
+    AdcFreeRunStart();
+    
+    //
+    // Main test loop
+    //
+    while(1)
+    {
+        const AdcSample *block = AdcFreeRunCaptureBlock(&freeRunInfo);
+        ProcessBlock(block, ADC_FREERUN_BLOCK_SAMPLES);
+        
+        // Report about once per second at the measured channel 0 rate
+        acqSampleRate = freeRunInfo.rateHz[0];
+        if (!tonesReady && (acqSampleRate > 0U))
+            InitTones(acqSampleRate);
+        if (!biquadsReady && (acqSampleRate > 0U))
+            InitBiquads(acqSampleRate);
+        if (samplesSinceReport < acqSampleRate)
+            continue;
+        samplesSinceReport = 0;
+        
+#if (STATISTICS_PATH != STATS_PATH_FLOAT)
+        LoadDeferredStatistics();
+#endif
+        
+        // Display latest readings
+        DisplayReadings();
+        
+        // Toggle LED
+        GPIO_togglePin(LED_GPIO);
+        
+        // Display statistics every 10 reports
+        if ((testIteration > 0) && (testIteration % TEST_ITERATIONS == 0))
+        {
+            DisplayStatistics();
+            InitStatistics();  // Reset for next batch
+        }
+        
+        // Increment counter
+        testIteration++;
+    }
+#elif (ACQUISITION_MODE == ACQ_MODE_CLA)
+    //
+    // CLA offload: ePWM1 SOCA triggers the ADCs, ADCINT1 triggers CLA task 1,
+    // which converts and accumulates; the C28x only reads finished windows
+    //
+    acqSampleRate = AdcAcquisitionInit(ACQ_SAMPLE_RATE_HZ);
+    AdcClaInit(acqSampleRate);  // One statistics window per second
+    UARTSendString(">>> CLA acquisition at ");
+    UARTSendUInt(acqSampleRate);
+    UARTSendString(" Hz\r\n\r\n");
+    
+    AdcAcquisitionStart();
+    
+    //
+    // Main test loop
+    //
+    while(1)
+    {
+        // Wait for the CLA to publish the next window
+        if (!AdcClaReadStats(&claStats))
+            continue;
+        LoadClaStatistics();
+        
+        // Display latest readings
+        DisplayReadings();
+        
+        // Toggle LED
+        GPIO_togglePin(LED_GPIO);
+        
+        // Display statistics of the window every 10 reports
+        if ((testIteration > 0) && (testIteration % TEST_ITERATIONS == 0))
+            DisplayStatistics();
+        
+        // Increment counter
+        testIteration++;
+    }
+#elif (ACQUISITION_MODE == ACQ_MODE_DUALCORE)
+    //
+    // Dual-core: CPU1 only acquires (ePWM-paced DMA blocks); each finished
+    // block is handed to CPU2 over IPC, which returns the analysis results
+    //
+    acqSampleRate = AdcAcquisitionInit(ACQ_SAMPLE_RATE_HZ);
+    if (!AdcDualCoreInit(acqSampleRate))
+    {
+        UARTSendString(">>> Dual-core: CPU2 boots from flash, use the _FLASH build\r\n");
+        while(1)
+        {
+        }
+    }
+    UARTSendString(">>> Dual-core acquisition at ");
+    UARTSendUInt(acqSampleRate);
+    UARTSendString(" Hz, analysis on CPU2\r\n\r\n");
+    
+    AdcDmaCaptureInit(AdcDualCoreSendBlock);
+    AdcDmaCaptureStart();
+    
+    //
+    // Main test loop
+    //
+    while(1)
+    {
+        // Collect the results of every block analyzed by CPU2
+        if (!AdcDualCoreReadResults(&dualCoreResults))
+            continue;
+        samplesSinceReport += dualCoreResults.numSamples;
+        
+        // Skip results of a block the DMA refilled while CPU2 analyzed it
+        if (!dualCoreResults.valid)
+            continue;
+        
+        // Report once per second of acquired samples
+        if (samplesSinceReport < acqSampleRate)
+            continue;
+        samplesSinceReport = 0;
+        
+        DisplayDualCoreResults();
+        
+        // Toggle LED
+        GPIO_togglePin(LED_GPIO);
+        
+        // Increment counter
+        testIteration++;
+    }
+#else
+#if (ACQUISITION_MODE == ACQ_MODE_OVERSAMPLE)
+    //
+    // Chain 2^OVERSAMPLE_LOG2 SOCs per converter on the same input
+    //
+    {
+        uint16_t ch;
+        AdcOversampleConfig ovsConfig[NUM_ADC_CHANNELS];
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        {
+            ovsConfig[ch].ratioLog2 = OVERSAMPLE_LOG2;
+            ovsConfig[ch].extraBits = OVERSAMPLE_EXTRA_BITS;
+        }
+        if (!AdcOversampleInit(ovsConfig, ADC_TRIGGER_SW_ONLY))
+        {
+            UARTSendString(">>> Oversampling: one converter per channel, chain within SOC0..SOC15\r\n");
+            while(1)
+            {
+            }
+        }
+    }
+#endif
+    
     //
     // Main test loop
     //
     while(1)
     {
+#if (ACQUISITION_MODE == ACQ_MODE_OVERSAMPLE)
+        // Perform oversampled conversion (one pass sum of the SOC chain)
+        AdcOversampleConvert(adcOversampleCodes);
+        AdcCalOversampleResult(adcVoltages, adcOversampleCodes);
+        
+        // Raw column shows the code at native resolution
+        {
+            uint16_t ch;
+            for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+                adcRawData[ch] = (uint16_t)(adcOversampleCodes[ch] >>
+                                            AdcOversampleGetExtraBits(ch));
+        }
+#else
         // Perform ADC conversion
         AdcConversion(adcRawData);
         
-        // Convert to voltages
-        AdcResult(adcVoltages, adcRawData);
+        // Convert the offset-corrected PPB results to calibrated voltages
+        AdcCalPpbResult(adcVoltages);
+#endif
         
         // Update statistics
         UpdateStatistics();
@@ -186,6 +731,7 @@ void main(void)
         // 1 second delay
         DEVICE_DELAY_US(1000000);
     }
+#endif
 }
 
 /*********************************************************************************
@@ -210,7 +756,7 @@ void UARTSendString(const char *str)
     uint16_t i = 0;
     while (str[i] != '\0')
     {
-        SCI_writeCharBlockingFIFO(UART_BASE, str[i]);
+        UartTxWrite((uint16_t)str[i]);
         i++;
     }
 }
@@ -220,7 +766,7 @@ void UARTSendString(const char *str)
  */
 void UARTSendChar(char c)
 {
-    SCI_writeCharBlockingFIFO(UART_BASE, c);
+    UartTxWrite((uint16_t)c);
 }
 
 /**
@@ -313,18 +859,33 @@ void UARTSendFloat(float value)
 }
 
 /**
- * @brief Initialize statistics arrays
+ * @brief Send 16-bit value via UART as 4 hex digits
+ */
+void UARTSendHex16(uint16_t value)
+{
+    int16_t shift;
+    
+    for (shift = 12; shift >= 0; shift -= 4)
+        UARTSendChar("0123456789ABCDEF"[(value >> shift) & 0xFU]);
+}
+
+/**
+ * @brief Start a new statistics batch (the finished batch is merged into totalStats)
  */
 void InitStatistics(void)
 {
     uint16_t i;
     for (i = 0; i < NUM_ADC_CHANNELS; i++)
     {
-        minVoltages[i] = 10.0f;
-        maxVoltages[i] = -10.0f;
-        sumVoltages[i] = 0.0f;
-        avgVoltages[i] = 0.0f;
+        AdcStatsMerge(&totalStats[i], &channelStats[i]);
+        AdcStatsReset(&channelStats[i]);
+        AdcCodeStatsReset(&codeStats[i]);
+        AdcStatsReset(&decimatedStats[i]);
+        AdcStatsReset(&firStats[i]);
+        AdcStatsReset(&biquadStats[i]);
+        AdcStatsReset(&despikedStats[i]);
     }
+    AdcFixedStatsReset(&fixedStats);
 }
 
 /**
@@ -334,15 +895,7 @@ void UpdateStatistics(void)
 {
     uint16_t i;
     for (i = 0; i < NUM_ADC_CHANNELS; i++)
-    {
-        if (adcVoltages[i] < minVoltages[i])
-            minVoltages[i] = adcVoltages[i];
-        
-        if (adcVoltages[i] > maxVoltages[i])
-            maxVoltages[i] = adcVoltages[i];
-        
-        sumVoltages[i] += adcVoltages[i];
-    }
+        AdcStatsUpdate(&channelStats[i], adcVoltages[i]);
 }
 
 /**
@@ -375,21 +928,18 @@ void DisplayHeader(void)
 void DisplayReadings(void)
 {
     uint16_t i;
-    const char *names[NUM_ADC_CHANNELS] = {
-        "ADCA-Diff",
-        "ADCB-SE  "
-    };
+    uint16_t limitEvents;
     
     UARTSendString("\r\n--- Reading #");
     UARTSendUInt(testIteration);
     UARTSendString(" ---\r\n");
-    UARTSendString("Channel    | Raw    | Voltage (V)\r\n");
-    UARTSendString("-----------|--------|-------------\r\n");
+    UARTSendString("Channel    | Raw    | Voltage (V) | MA (V)   | EMA (V)\r\n");
+    UARTSendString("-----------|--------|-------------|----------|---------\r\n");
     
     for (i = 0; i < NUM_ADC_CHANNELS; i++)
     {
         // Print channel name
-        UARTSendString(names[i]);
+        UARTSendString(adcChannels[i].name);
         UARTSendString(" | ");
         
         // Print raw value (5 digits with padding)
@@ -401,8 +951,64 @@ void DisplayReadings(void)
         
         UARTSendString(" | ");
         UARTSendFloat(adcVoltages[i]);
+        
+        // Smoothed values are kept current by the pipeline: scale only
+        if (smoothingReady)
+        {
+            float maVolts;
+            float emaVolts;
+            
+            GetSmoothedVolts(i, &maVolts, &emaVolts);
+            UARTSendString(" | ");
+            UARTSendFloat(maVolts);
+            UARTSendString(" | ");
+            UARTSendFloat(emaVolts);
+        }
         UARTSendString("\r\n");
     }
+    
+    DisplayWindows();
+    DisplaySpectrum();
+    
+    UARTSendString("PPB limit trips: ");
+    limitEvents = AdcPpbGetLimitEvents();
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+        UARTSendChar((limitEvents & (1U << i)) ? 'X' : '-');
+    UARTSendString("\r\n");
+    
+#if (ACQUISITION_MODE == ACQ_MODE_EPWM)
+    UARTSendString("Ring overruns: ");
+    UARTSendUInt(AdcAcquisitionGetOverruns());
+    UARTSendString(" samples in ");
+    UARTSendUInt(AdcAcquisitionGetGaps());
+    UARTSendString(" gaps (stream filters restarted)\r\n");
+#elif (ACQUISITION_MODE == ACQ_MODE_DMA)
+    UARTSendString("DMA blocks: ");
+    UARTSendUInt(AdcDmaGetBlockCount());
+    UARTSendString(", replaced unprocessed: ");
+    UARTSendUInt(dmaBlocksReplaced);
+    UARTSendString(", overflows: ");
+    UARTSendUInt(AdcDmaGetOverflows());
+    UARTSendString("\r\n");
+#elif (ACQUISITION_MODE == ACQ_MODE_FREERUN)
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        UARTSendString(adcChannels[i].name);
+        UARTSendString(" rate: ");
+        UARTSendUInt(freeRunInfo.rateHz[i]);
+        UARTSendString(" Hz, lost: ");
+        UARTSendUInt(freeRunInfo.lost[i]);
+        UARTSendString(" (total ");
+        UARTSendUInt(AdcFreeRunGetLost(i));
+        UARTSendString(")\r\n");
+    }
+#elif (ACQUISITION_MODE == ACQ_MODE_CLA)
+    UARTSendString("CLA window: ");
+    UARTSendUInt(claStats.samples);
+    UARTSendString(" samples, task overflow: ");
+    UARTSendString(AdcClaTaskOverflowed() ? "YES" : "no");
+    UARTSendString("\r\n");
+#endif
 }
 
 /**
@@ -411,50 +1017,87 @@ void DisplayReadings(void)
 void DisplayStatistics(void)
 {
     uint16_t i;
-    uint32_t sampleCount = testIteration % TEST_ITERATIONS;
-    if (sampleCount == 0) sampleCount = TEST_ITERATIONS;
-    
-    const char *names[NUM_ADC_CHANNELS] = {
-        "ADCA-Diff",
-        "ADCB-SE  "
-    };
     
     UARTSendString("\r\n");
-    UARTSendString("============================================\r\n");
+    UARTSendString("====================================================\r\n");
     UARTSendString("STATISTICS (Last ");
-    UARTSendUInt(sampleCount);
-    UARTSendString(" readings)\r\n");
-    UARTSendString("============================================\r\n");
-    UARTSendString("Channel    | Min(V)  | Max(V)  | Avg(V)  | P-P(mV)\r\n");
-    UARTSendString("-----------|---------|---------|---------|--------\r\n");
+    UARTSendUInt(channelStats[0].count);
+    UARTSendString(" samples)\r\n");
+    UARTSendString("====================================================\r\n");
+    UARTSendString("Channel    | Min(V)  | Max(V)  | Avg(V)  | Std(mV) | P-P(mV)\r\n");
+    UARTSendString("-----------|---------|---------|---------|---------|--------\r\n");
     
     for (i = 0; i < NUM_ADC_CHANNELS; i++)
     {
-        float peakToPeak = (maxVoltages[i] - minVoltages[i]) * 1000.0f;
-        avgVoltages[i] = sumVoltages[i] / (float)sampleCount;
+        const AdcStats *st = &channelStats[i];
         
         // Channel name
-        UARTSendString(names[i]);
+        UARTSendString(adcChannels[i].name);
         UARTSendString(" | ");
         
         // Min voltage
-        UARTSendFloat(minVoltages[i]);
+        UARTSendFloat(st->min);
         UARTSendString(" | ");
         
         // Max voltage
-        UARTSendFloat(maxVoltages[i]);
+        UARTSendFloat(st->max);
         UARTSendString(" | ");
         
         // Avg voltage
-        UARTSendFloat(avgVoltages[i]);
+        UARTSendFloat(AdcStatsMean(st));
+        UARTSendString(" | ");
+        
+        // Standard deviation in mV
+        if (statsHaveVariance)
+            UARTSendFloat(AdcStatsStdDev(st) * 1000.0f);
+        else
+            UARTSendString("n/a");
         UARTSendString(" | ");
         
         // Peak-to-peak in mV
-        UARTSendFloat(peakToPeak);
+        UARTSendFloat(AdcStatsPeakToPeak(st) * 1000.0f);
         UARTSendString("\r\n");
     }
+    DisplayDespiked();
+    
+    // Running totals, including this batch
+    UARTSendString("Since start-up:\r\n");
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        AdcStats total = totalStats[i];
+        AdcStatsMerge(&total, &channelStats[i]);
+        
+        UARTSendString(adcChannels[i].name);
+        UARTSendString(" | n ");
+        UARTSendUInt(total.count);
+        UARTSendString(", avg ");
+        UARTSendFloat(AdcStatsMean(&total));
+        if (statsHaveVariance)
+        {
+            UARTSendString(" V, std ");
+            UARTSendFloat(AdcStatsStdDev(&total) * 1000.0f);
+            UARTSendString(" mV\r\n");
+        }
+        else
+            UARTSendString(" V, std n/a\r\n");
+    }
+    
+    DisplayQuantiles();
+    DisplayTones();
+    DisplayDecimated();
+    DisplayFilters();
+    DisplayBiquads();
+    DisplayHistograms();
+    
+    UARTSendString("====================================================\r\n\r\n");
     
-    UARTSendString("============================================\r\n\r\n");
+#if HISTOGRAM_EXPORT
+    if (histogramsReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            AdcHistogramExport(&codeHistograms[i], i, &UARTSendByte);
+    }
+#endif
 }
 
 /**
@@ -462,26 +1105,1460 @@ void DisplayStatistics(void)
  */
 bool VerifyADCReadings(void)
 {
-    uint16_t i;
-    uint16_t validCount = 0;
+    // Channels whose reading is stuck at limits: PPB trip events latched by
+    // the conversion (margins ADC_LIMIT_MARGIN_16BIT/_12BIT)
+    uint16_t tripped = AdcPpbGetLimitEvents();
     
-    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    // At least one channel should have valid reading
+    return (tripped != (uint16_t)((1U << NUM_ADC_CHANNELS) - 1U));
+}
+
+/**
+ * @brief DMA block callback (DMA ISR context): hand the block to the main loop
+ */
+void DmaBlockReady(const AdcSample *block, uint16_t numSamples)
+{
+    // The main loop has not taken the previous block yet
+    if (dmaReadyBlock != NULL)
+        dmaBlocksReplaced++;
+    
+    dmaReadySamples = numSamples;
+    dmaReadyBlock = block;
+}
+
+/**
+ * @brief Convert a finished block and feed it into the statistics
+ */
+void ProcessBlock(const AdcSample *block, uint16_t numSamples)
+{
+    uint16_t ch;
+    
+#if (STATISTICS_PATH != STATS_PATH_Q24)
+    // Code-domain analysis of the block (the Q24 path feeds it per sample in
+    // ConvertAndAccumulate())
+    if (windowsReady)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            AdcWindowUpdateBlock(&slidingWindows[ch], &block[0].raw[ch], numSamples,
+                                 NUM_ADC_CHANNELS);
+    }
+    if (histogramsReady)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            AdcHistogramUpdateBlock(&codeHistograms[ch], &block[0].raw[ch], numSamples,
+                                    NUM_ADC_CHANNELS);
+    }
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        uint16_t k;
+        for (k = 0; k < NUM_QUANTILES; k++)
+            AdcQuantileUpdateCodes(&channelQuantiles[ch][k], &block[0].raw[ch], numSamples,
+                                   NUM_ADC_CHANNELS);
+    }
+    if (spectrumReady && !spectrumFresh &&
+        AdcSpectrumCapture(&block[0].raw[spectrumChannel], numSamples, NUM_ADC_CHANNELS))
+        AnalyzeSpectrum();
+    if (tonesReady)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            AdcGoertzelUpdateBlock(&toneBanks[ch], &block[0].raw[ch], numSamples,
+                                   NUM_ADC_CHANNELS);
+    }
+    if (decimatorsReady)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            DecimateCodes(ch, &block[0].raw[ch], numSamples, NUM_ADC_CHANNELS);
+    }
+    if (firReady)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            FilterCodes(ch, &block[0].raw[ch], numSamples, NUM_ADC_CHANNELS);
+    }
+    if (biquadsReady)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            BiquadCodes(ch, &block[0].raw[ch], numSamples, NUM_ADC_CHANNELS);
+    }
+    if (smoothingReady)
     {
-        // Check if reading is not stuck at limits
-        if (i == 0)
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
         {
-            // Differential channel - check if not at extreme limits
-            if (adcRawData[i] > 100 && adcRawData[i] < 65435)
-                validCount++;
+            AdcMovingAverageUpdateBlock(&movingAverages[ch], &block[0].raw[ch], numSamples,
+                                        NUM_ADC_CHANNELS);
+            AdcEmaUpdateBlock(&emaFilters[ch], &block[0].raw[ch], numSamples,
+                              NUM_ADC_CHANNELS);
         }
-        else
+    }
+    if (despikeReady)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            DespikeCodes(ch, &block[0].raw[ch], numSamples, NUM_ADC_CHANNELS);
+    }
+#endif
+    
+#if (STATISTICS_PATH == STATS_PATH_CODES)
+    // Integer sums straight from the block; conversion at report time
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        AdcCodeStatsUpdateBlock(&codeStats[ch], &block[0].raw[ch], numSamples,
+                                NUM_ADC_CHANNELS);
+        if (numSamples > 0U)
+            adcRawData[ch] = block[numSamples - 1U].raw[ch];
+    }
+#elif (STATISTICS_PATH == STATS_PATH_Q24)
+    uint16_t i;
+    
+    for (i = 0; i < numSamples; i++)
+    {
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            adcRawData[ch] = block[i].raw[ch];
+        
+        ConvertAndAccumulate();
+    }
+#else
+    uint16_t start;
+    
+    // Convert each channel a chunk at a time, then accumulate the chunk
+    for (start = 0; start < numSamples; start += BLOCK_CHUNK_SAMPLES)
+    {
+        uint16_t len = numSamples - start;
+        if (len > BLOCK_CHUNK_SAMPLES)
+            len = BLOCK_CHUNK_SAMPLES;
+        
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            AdcCalResultBlock(blockVoltages[ch], &block[start].raw[ch], len,
+                              NUM_ADC_CHANNELS, ch);
+        
+        // Chunk statistics merged into the running statistics
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            AdcStatsUpdateBlock(&channelStats[ch], blockVoltages[ch], len);
+    }
+    
+    // Latest sample for the readings display
+    if (numSamples > 0U)
+    {
+        uint16_t last = (numSamples - 1U) % BLOCK_CHUNK_SAMPLES;
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
         {
-            // Single-ended channel - check if not at extreme limits
-            if (adcRawData[i] > 10 && adcRawData[i] < 4086)
-                validCount++;
+            adcRawData[ch] = block[numSamples - 1U].raw[ch];
+            adcVoltages[ch] = blockVoltages[ch][last];
         }
     }
-    
-    // At least one channel should have valid reading
-    return (validCount > 0);
-}
\ No newline at end of file
+#endif
+    samplesSinceReport += numSamples;
+}
+
+/**
+ * @brief Display the simultaneous-sampling skew self-test result
+ */
+void DisplaySkewResult(void)
+{
+    UARTSendString("\r\n>>> Simultaneous Sampling Skew Test (");
+    UARTSendUInt(skewResult.numTriggers);
+    UARTSendString(" triggers)\r\n");
+    UARTSendString("    Skew A-B (cycles): min ");
+    UARTSendInt(skewResult.minSkew);
+    UARTSendString(", max ");
+    UARTSendInt(skewResult.maxSkew);
+    UARTSendString(", mean ");
+    UARTSendFloat(skewResult.meanSkew);
+    UARTSendString("\r\n");
+    UARTSendString("    Max trigger delay (cycles): A ");
+    UARTSendUInt(skewResult.maxDelayA);
+    UARTSendString(", B ");
+    UARTSendUInt(skewResult.maxDelayB);
+    UARTSendString("\r\n");
+    
+    if (skewResult.aligned)
+        UARTSendString(">>> Simultaneous Sampling: PASSED\r\n");
+    else
+        UARTSendString(">>> Simultaneous Sampling: WARNING (skew detected)\r\n");
+}
+
+/**
+ * @brief Display the latest burst scan frame (ACQ_MODE_SCAN)
+ */
+void DisplayScanFrame(void)
+{
+    uint16_t c, i;
+    uint16_t out = 0;
+    
+    UARTSendString("\r\n--- Scan Frame #");
+    UARTSendUInt(scanFrame.sequence);
+    UARTSendString(" ---\r\n");
+    UARTSendString("Channel    | Raw    | Voltage (V)\r\n");
+    UARTSendString("-----------|--------|-------------\r\n");
+    
+    for (c = 0; c < ADC_SCAN_NUM_CONVERTERS; c++)
+    {
+        const AdcScanConverter *cv = &adcScanDefaultList[c];
+        bool diff = (cv->signalMode == ADC_MODE_DIFFERENTIAL);
+        
+        for (i = 0; (i < cv->numChannels) && (out < scanFrame.numChannels); i++)
+        {
+            uint16_t pin = (uint16_t)cv->channels[i];
+            uint16_t code = scanFrame.code[out];
+            
+            uint16_t nameLen = 5;
+            
+            // Channel name padded to 9 characters, e.g. "ADCA0-1" or "ADCB2"
+            UARTSendString("ADC");
+            UARTSendChar((char)('A' + c));
+            UARTSendUInt(pin);
+            if (pin >= 10U) nameLen++;
+            if (diff)
+            {
+                UARTSendChar('-');
+                UARTSendUInt(pin + 1U);
+                nameLen += (pin + 1U >= 10U) ? 3U : 2U;
+            }
+            for (; nameLen < 9U; nameLen++)
+                UARTSendChar(' ');
+            UARTSendString(" | ");
+            
+            // Raw value (5 digits with padding)
+            if (code < 10000) UARTSendChar(' ');
+            if (code < 1000) UARTSendChar(' ');
+            if (code < 100) UARTSendChar(' ');
+            if (code < 10) UARTSendChar(' ');
+            UARTSendUInt(code);
+            
+            UARTSendString(" | ");
+            UARTSendFloat(scanVoltages[out]);
+            UARTSendString("\r\n");
+            out++;
+        }
+    }
+    
+    UARTSendString("Overflows: ");
+    UARTSendUInt(AdcScanGetOverflows());
+    UARTSendString("\r\n");
+}
+
+/**
+ * @brief Copy the CLA statistics window into the display arrays (ACQ_MODE_CLA)
+ */
+void LoadClaStatistics(void)
+{
+    uint16_t i;
+    
+    statsHaveVariance = false;
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        adcRawData[i] = claStats.channel[i].lastCode;
+        adcVoltages[i] = claStats.channel[i].last;
+        
+        // The CLA window carries no variance: standard deviation shows n/a
+        channelStats[i].count = claStats.samples;
+        channelStats[i].mean = claStats.channel[i].mean;
+        channelStats[i].m2 = 0.0f;
+        channelStats[i].min = claStats.channel[i].min;
+        channelStats[i].max = claStats.channel[i].max;
+    }
+}
+
+/**
+ * @brief Display the latest CPU2 block analysis (ACQ_MODE_DUALCORE)
+ */
+void DisplayDualCoreResults(void)
+{
+    uint16_t i;
+    
+    UARTSendString("\r\n--- CPU2 Block #");
+    UARTSendUInt(dualCoreResults.sequence);
+    UARTSendString(" (");
+    UARTSendUInt(dualCoreResults.numSamples);
+    UARTSendString(" samples, ");
+    UARTSendUInt(dualCoreResults.cycles);
+    UARTSendString(" cycles) ---\r\n");
+    UARTSendString("Channel    | Mean     | Min      | Max      | RMS AC   | Filtered | Freq (Hz)\r\n");
+    
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        const AdcIpcChannelResult *r = &dualCoreResults.channel[i];
+        
+        UARTSendString(adcChannels[i].name);
+        UARTSendString(" | ");
+        UARTSendFloat(r->mean);
+        UARTSendString(" | ");
+        UARTSendFloat(r->min);
+        UARTSendString(" | ");
+        UARTSendFloat(r->max);
+        UARTSendString(" | ");
+        UARTSendFloat(r->rmsAc);
+        UARTSendString(" | ");
+        UARTSendFloat(r->filtered);
+        UARTSendString(" | ");
+        UARTSendFloat(r->frequencyHz);
+        UARTSendString("\r\n");
+    }
+    
+    // Goertzel tones tracked on CPU2 (toneHz 0: tone tracking off)
+    if ((dualCoreResults.toneHz[0] > 0.0f) && !dualCoreResults.tonesValid)
+    {
+        UARTSendString("Tones: waiting for a complete block (restarted after a lost block)\r\n");
+    }
+    else if (dualCoreResults.toneHz[0] > 0.0f)
+    {
+        UARTSendString("Tones: amplitude mV / phase deg\r\n");
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+        {
+            const AdcIpcChannelResult *r = &dualCoreResults.channel[i];
+            uint16_t k;
+            
+            UARTSendString(adcChannels[i].name);
+            for (k = 0; k < ADC_IPC_MAX_TONES; k++)
+            {
+                if (dualCoreResults.toneHz[k] <= 0.0f)
+                    continue;
+                UARTSendString(" | ");
+                UARTSendUInt((uint32_t)dualCoreResults.toneHz[k]);
+                UARTSendString(" Hz ");
+                UARTSendFloat(r->toneAmplitude[k] * 1000.0f);
+                UARTSendString(" / ");
+                UARTSendFloat(r->tonePhaseDeg[k]);
+            }
+            UARTSendString("\r\n");
+        }
+    }
+    
+    UARTSendString("Blocks sent: ");
+    UARTSendUInt(AdcDualCoreGetBlocksSent());
+    UARTSendString(", dropped (CPU2 busy): ");
+    UARTSendUInt(AdcDualCoreGetBlocksDropped());
+    UARTSendString(", overwritten during analysis: ");
+    UARTSendUInt(dualCoreResults.overwritten);
+    UARTSendString(", DMA overflows: ");
+    UARTSendUInt(AdcDmaGetOverflows());
+    UARTSendString("\r\n");
+}
+
+/**
+ * @brief Convert the latest raw sample and feed it into the statistics
+ *
+ * STATISTICS_PATH selects the path; with the integer paths, float conversion
+ * is deferred to LoadDeferredStatistics() at display time.
+ */
+void ConvertAndAccumulate(void)
+{
+    uint16_t i;
+    
+    if (windowsReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            AdcWindowUpdate(&slidingWindows[i], adcRawData[i]);
+    }
+    if (histogramsReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            AdcHistogramUpdate(&codeHistograms[i], adcRawData[i]);
+    }
+    UpdateQuantiles();
+    if (spectrumReady && !spectrumFresh &&
+        AdcSpectrumCapture(&adcRawData[spectrumChannel], 1U, 1U))
+        AnalyzeSpectrum();
+    if (tonesReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            AdcGoertzelUpdate(&toneBanks[i], adcRawData[i]);
+    }
+    if (decimatorsReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            DecimateCodes(i, &adcRawData[i], 1U, 1U);
+    }
+    if (firReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            FilterCodes(i, &adcRawData[i], 1U, 1U);
+    }
+    if (biquadsReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            BiquadCodes(i, &adcRawData[i], 1U, 1U);
+    }
+    if (smoothingReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+        {
+            AdcMovingAverageUpdate(&movingAverages[i], adcRawData[i]);
+            AdcEmaUpdate(&emaFilters[i], adcRawData[i]);
+        }
+    }
+    if (despikeReady)
+    {
+        for (i = 0; i < NUM_ADC_CHANNELS; i++)
+            DespikeCodes(i, &adcRawData[i], 1U, 1U);
+    }
+    
+#if (STATISTICS_PATH == STATS_PATH_CODES)
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+        AdcCodeStatsUpdate(&codeStats[i], adcRawData[i]);
+#elif (STATISTICS_PATH == STATS_PATH_Q24)
+    AdcFixedResult(adcVoltagesQ24, adcRawData);
+    AdcFixedStatsUpdate(&fixedStats, adcVoltagesQ24);
+#else
+    AdcCalResult(adcVoltages, adcRawData);
+    UpdateStatistics();
+#endif
+}
+
+/**
+ * @brief Convert the integer statistics into the display arrays (integer paths)
+ */
+void LoadDeferredStatistics(void)
+{
+    uint16_t i;
+    
+#if (STATISTICS_PATH == STATS_PATH_CODES)
+    AdcCalResult(adcVoltages, adcRawData);
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+        AdcCodeStatsToVolts(&codeStats[i], AdcCalGetSlope(i), AdcCalGetIntercept(i),
+                            &channelStats[i]);
+#else
+    statsHaveVariance = false;
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        adcVoltages[i] = AdcFixedToVolts(adcVoltagesQ24[i]);
+        
+        // Q24 statistics carry no variance: standard deviation shows n/a
+        channelStats[i].count = fixedStats.count;
+        channelStats[i].mean = AdcFixedToVolts(AdcFixedStatsMean(&fixedStats, i));
+        channelStats[i].m2 = 0.0f;
+        channelStats[i].min = AdcFixedToVolts(fixedStats.min[i]);
+        channelStats[i].max = AdcFixedToVolts(fixedStats.max[i]);
+    }
+#endif
+}
+
+/**
+ * @brief Measure the conversion + statistics paths in cycles per sample
+ *
+ * Each path converts and accumulates the start-up reading BENCH_SAMPLES
+ * times; the statistics are cleared again afterwards.
+ */
+void BenchmarkConversionPaths(void)
+{
+    uint16_t n;
+    uint32_t start;
+    uint16_t width;
+    
+    benchQuantileMaxCycles = 0;
+    benchFirCycles = 0;
+    benchFirTaps = 0;
+    benchBiquadCycles = 0;
+    benchBiquadMaxCycles = 0;
+    benchSmoothCycles = 0;
+    
+    // Keep the UART TX interrupt out of the timings
+    UartTxFlush();
+    CycleCounterInit();
+    InitStatistics();
+    
+    start = CycleCounterRead();
+    for (n = 0; n < BENCH_SAMPLES; n++)
+    {
+        AdcCalResult(adcVoltages, adcRawData);
+        UpdateStatistics();
+    }
+    benchFloatCycles = CycleCounterRead() - start;
+    
+    start = CycleCounterRead();
+    for (n = 0; n < BENCH_SAMPLES; n++)
+    {
+        AdcFixedResult(adcVoltagesQ24, adcRawData);
+        AdcFixedStatsUpdate(&fixedStats, adcVoltagesQ24);
+    }
+    benchFixedCycles = CycleCounterRead() - start;
+    
+    start = CycleCounterRead();
+    for (n = 0; n < BENCH_SAMPLES; n++)
+    {
+        uint16_t ch;
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            AdcCodeStatsUpdate(&codeStats[ch], adcRawData[ch]);
+    }
+    benchCodeCycles = CycleCounterRead() - start;
+    
+    // Conversion only: one channel, a contiguous chunk per call
+    for (n = 0; n < BLOCK_CHUNK_SAMPLES; n++)
+        benchCodes[n] = adcRawData[0];
+    start = CycleCounterRead();
+    for (n = 0; n < BENCH_SAMPLES; n += BLOCK_CHUNK_SAMPLES)
+        AdcCalResultBlock(blockVoltages[0], benchCodes, BLOCK_CHUNK_SAMPLES, 1U, 0U);
+    benchBlockCycles = CycleCounterRead() - start;
+    benchBlockSamples = ((BENCH_SAMPLES + BLOCK_CHUNK_SAMPLES - 1U) / BLOCK_CHUNK_SAMPLES) *
+                        BLOCK_CHUNK_SAMPLES;
+    
+    // Quantiles: spread the codes so markers move, and keep the worst sample
+    benchQuantileCycles = 0;
+    for (n = 0; n < BENCH_SAMPLES; n++)
+    {
+        uint16_t ch;
+        uint32_t cycles;
+        
+        start = CycleCounterRead();
+        for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+        {
+            uint16_t k;
+            for (k = 0; k < NUM_QUANTILES; k++)
+                AdcQuantileUpdate(&channelQuantiles[ch][k],
+                                  (float)(uint16_t)(adcRawData[ch] + ((n * 37U) & 63U)));
+        }
+        cycles = CycleCounterRead() - start;
+        
+        benchQuantileCycles += cycles;
+        if (cycles > benchQuantileMaxCycles)
+            benchQuantileMaxCycles = cycles;
+    }
+    
+    // FIR: float block from the conversion benchmark, cycles per coefficient
+    if (firReady)
+    {
+        const uint16_t chunk = ((FIR_OUT_SAMPLES - 1U) * FIR_DECIMATION < BLOCK_CHUNK_SAMPLES) ?
+                               ((FIR_OUT_SAMPLES - 1U) * FIR_DECIMATION) : BLOCK_CHUNK_SAMPLES;
+        
+        start = CycleCounterRead();
+        for (n = 0; n < BENCH_SAMPLES; n += chunk)
+            benchFirTaps += AdcFirProcess(&firFilters[0], blockVoltages[0], chunk, firOutput);
+        benchFirCycles = CycleCounterRead() - start;
+        benchFirTaps *= firFilters[0].branchTaps;
+        AdcFirReset(&firFilters[0]);
+    }
+    
+    // Biquads: inline step per sample (worst case kept), then the block path,
+    // on a notch cascade designed for the nominal rate
+    for (n = 0; n < BIQUAD_SECTIONS; n++)
+        AdcBiquadDesignNotch(&benchSet[n], 50.0f + 10.0f * n, (float)ACQ_SAMPLE_RATE_HZ,
+                             BIQUAD_NOTCH_Q);
+    AdcBiquadInit(&benchCascade, benchSet, BIQUAD_SECTIONS);
+    AdcBiquadPrime(&benchCascade, (float)adcRawData[0]);
+    for (n = 0; n < BENCH_SAMPLES; n++)
+    {
+        float x = (float)(uint16_t)(adcRawData[0] + ((n * 37U) & 63U));
+        uint32_t cycles;
+        
+        start = CycleCounterRead();
+        biquadOutput[0] = AdcBiquadStep(&benchCascade, x);
+        cycles = CycleCounterRead() - start;
+        
+        benchBiquadCycles += cycles;
+        if (cycles > benchBiquadMaxCycles)
+            benchBiquadMaxCycles = cycles;
+    }
+    start = CycleCounterRead();
+    for (n = 0; n < BENCH_SAMPLES; n += BLOCK_CHUNK_SAMPLES)
+        AdcBiquadProcessBlock(&benchCascade, blockVoltages[0], biquadOutput, BLOCK_CHUNK_SAMPLES);
+    benchBiquadBlockCycles = CycleCounterRead() - start;
+    
+    // Smoothing: moving average + EMA of every channel, per sample
+    if (smoothingReady)
+    {
+        start = CycleCounterRead();
+        for (n = 0; n < BENCH_SAMPLES; n++)
+        {
+            uint16_t ch;
+            for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+            {
+                AdcMovingAverageUpdate(&movingAverages[ch], adcRawData[ch]);
+                AdcEmaUpdate(&emaFilters[ch], adcRawData[ch]);
+            }
+        }
+        benchSmoothCycles = CycleCounterRead() - start;
+    }
+    
+    // Median / Hampel per width: codes spread over 64 values so entries move,
+    // and a spike every 64 samples so Hampel replaces some
+    UARTSendString("\r\n>>> Median filter benchmark (cycles/sample, mean/max)\r\n");
+    for (width = ADC_MEDIAN_MIN_WIDTH; width <= ADC_MEDIAN_MAX_WIDTH; width += 2U)
+    {
+        uint16_t mode;
+        
+        for (mode = ADC_MEDIAN_MODE_MEDIAN; mode <= ADC_MEDIAN_MODE_HAMPEL; mode++)
+        {
+            AdcMedianInit(&despikeFilters[0], width, mode, DESPIKE_THRESHOLD);
+            benchMedianCycles[mode] = 0;
+            benchMedianMaxCycles[mode] = 0;
+            
+            for (n = 0; n < BENCH_SAMPLES; n++)
+            {
+                uint16_t code = (uint16_t)(adcRawData[0] + ((n * 37U) & 63U));
+                uint32_t cycles;
+                
+                if ((n & 63U) == 63U)
+                    code ^= 0x0800U;
+                
+                start = CycleCounterRead();
+                despikedCodes[0] = AdcMedianUpdate(&despikeFilters[0], code);
+                cycles = CycleCounterRead() - start;
+                
+                benchMedianCycles[mode] += cycles;
+                if (cycles > benchMedianMaxCycles[mode])
+                    benchMedianMaxCycles[mode] = cycles;
+            }
+        }
+        
+        UARTSendString("    W ");
+        if (width < 10U) UARTSendChar(' ');
+        UARTSendUInt(width);
+        UARTSendString(": median ");
+        UARTSendUInt(benchMedianCycles[ADC_MEDIAN_MODE_MEDIAN] / BENCH_SAMPLES);
+        UARTSendString(" / ");
+        UARTSendUInt(benchMedianMaxCycles[ADC_MEDIAN_MODE_MEDIAN]);
+        UARTSendString(", Hampel ");
+        UARTSendUInt(benchMedianCycles[ADC_MEDIAN_MODE_HAMPEL] / BENCH_SAMPLES);
+        UARTSendString(" / ");
+        UARTSendUInt(benchMedianMaxCycles[ADC_MEDIAN_MODE_HAMPEL]);
+        UARTSendString("\r\n");
+    }
+    
+    // Benchmark samples are not part of the statistics
+    for (n = 0; n < NUM_ADC_CHANNELS; n++)
+    {
+        AdcStatsReset(&channelStats[n]);
+        AdcCodeStatsReset(&codeStats[n]);
+    }
+    AdcFixedStatsReset(&fixedStats);
+    InitQuantiles();
+    InitSmoothing();
+    InitDespike();
+    
+    UARTSendString("\r\n>>> Conversion + statistics benchmark (");
+    UARTSendUInt(BENCH_SAMPLES);
+    UARTSendString(" samples, ");
+    UARTSendUInt(NUM_ADC_CHANNELS);
+    UARTSendString(" channels)\r\n");
+    UARTSendString("    Float path (cycles/sample): ");
+    UARTSendUInt(benchFloatCycles / BENCH_SAMPLES);
+    UARTSendString("\r\n");
+    UARTSendString("    Q24 path (cycles/sample):   ");
+    UARTSendUInt(benchFixedCycles / BENCH_SAMPLES);
+    UARTSendString("\r\n");
+    UARTSendString("    Raw-code path (cycles/sample): ");
+    UARTSendUInt(benchCodeCycles / BENCH_SAMPLES);
+    UARTSendString("\r\n");
+    UARTSendString("    AdcCalResultBlock (cycles/code, x100): ");
+    UARTSendUInt((benchBlockCycles * 100U) / benchBlockSamples);
+    UARTSendString("\r\n");
+    UARTSendString("    P2 quantiles (cycles/sample, mean/max): ");
+    UARTSendUInt(benchQuantileCycles / BENCH_SAMPLES);
+    UARTSendString(" / ");
+    UARTSendUInt(benchQuantileMaxCycles);
+    UARTSendString("\r\n");
+    if (benchFirTaps > 0U)
+    {
+        UARTSendString("    FIR (cycles/tap, x100): ");
+        UARTSendUInt((benchFirCycles * 100U) / benchFirTaps);
+        UARTSendString("\r\n");
+    }
+    UARTSendString("    Biquad step (cycles/section, mean/max): ");
+    UARTSendUInt(benchBiquadCycles / (BENCH_SAMPLES * BIQUAD_SECTIONS));
+    UARTSendString(" / ");
+    UARTSendUInt((benchBiquadMaxCycles + BIQUAD_SECTIONS - 1U) / BIQUAD_SECTIONS);
+    UARTSendString("\r\n");
+    UARTSendString("    Biquad block (cycles/section/sample, x100): ");
+    UARTSendUInt((benchBiquadBlockCycles * 100U) / (benchBlockSamples * BIQUAD_SECTIONS));
+    UARTSendString("\r\n");
+    if (smoothingReady)
+    {
+        UARTSendString("    MA + EMA smoothing (cycles/sample): ");
+        UARTSendUInt(benchSmoothCycles / BENCH_SAMPLES);
+        UARTSendString("\r\n");
+    }
+    UARTSendString("    Active path: ");
+#if (STATISTICS_PATH == STATS_PATH_CODES)
+    UARTSendString("raw codes\r\n");
+#elif (STATISTICS_PATH == STATS_PATH_Q24)
+    UARTSendString("Q24 fixed-point\r\n");
+#else
+    UARTSendString("float\r\n");
+#endif
+}
+
+/**
+ * @brief Two-point calibration of every channel (CALIBRATION_PROCEDURE)
+ *
+ * For each channel, asks for a low and a high reference input (at
+ * CAL_LOW_FRACTION and CAL_HIGH_FRACTION of the ideal input range), waits
+ * CAL_SETTLE_US for each, averages CAL_SAMPLES polled conversions and derives
+ * the gain and offset. The resulting table image is dumped in hex with its
+ * flash address, to be programmed into the adccal section.
+ */
+void RunCalibration(void)
+{
+    uint16_t ch;
+    uint16_t i;
+    uint16_t numWords;
+    const uint16_t *word;
+    AdcCalTable table;
+    
+    UARTSendString("\r\n>>> Two-point calibration\r\n");
+    
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcChannelDescriptor *desc = &adcChannels[ch];
+        float voltsLow = ((float)desc->maxCode * CAL_LOW_FRACTION - (float)desc->midScale) *
+                         desc->scale;
+        float voltsHigh = ((float)desc->maxCode * CAL_HIGH_FRACTION - (float)desc->midScale) *
+                          desc->scale;
+        float codeLow;
+        float codeHigh;
+        const AdcCalRecord *rec;
+        
+        UARTSendString("    Apply ");
+        UARTSendFloat(voltsLow);
+        UARTSendString(" V to ");
+        UARTSendString(desc->name);
+        UARTSendString("\r\n");
+        DEVICE_DELAY_US(CAL_SETTLE_US);
+        codeLow = AdcCalMeasureCode(ch, CAL_SAMPLES);
+        
+        UARTSendString("    Apply ");
+        UARTSendFloat(voltsHigh);
+        UARTSendString(" V to ");
+        UARTSendString(desc->name);
+        UARTSendString("\r\n");
+        DEVICE_DELAY_US(CAL_SETTLE_US);
+        codeHigh = AdcCalMeasureCode(ch, CAL_SAMPLES);
+        
+        UARTSendString("    ");
+        UARTSendString(desc->name);
+        if (!AdcCalFromTwoPoints(ch, codeLow, voltsLow, codeHigh, voltsHigh))
+        {
+            UARTSendString(": REJECTED (check the reference inputs)\r\n");
+            continue;
+        }
+        rec = AdcCalGetRecord(ch);
+        UARTSendString(": gain error ");
+        UARTSendInt((int32_t)((rec->gain - 1.0f) * 1000000.0f));
+        UARTSendString(" ppm, offset ");
+        UARTSendInt((int32_t)(rec->offset * 1000000.0f));
+        UARTSendString(" uV\r\n");
+    }
+    
+    //
+    // Table image to program into the adccal section
+    //
+    AdcCalExport(&table);
+    word = (const uint16_t *)&table;
+    numWords = sizeof(table);
+    
+    UARTSendString("    Table at 0x");
+    UARTSendHex16((uint16_t)((uint32_t)AdcCalGetStore() >> 16));
+    UARTSendHex16((uint16_t)(uint32_t)AdcCalGetStore());
+    UARTSendString(" (");
+    UARTSendUInt(numWords);
+    UARTSendString(" words):\r\n   ");
+    for (i = 0; i < numWords; i++)
+    {
+        UARTSendChar(' ');
+        UARTSendHex16(word[i]);
+        if ((i % 8U) == 7U)
+            UARTSendString("\r\n   ");
+    }
+    UARTSendString("\r\n");
+}
+
+/**
+ * @brief Allocate one sliding window per channel in GS RAM
+ */
+void InitWindows(void)
+{
+    uint16_t i;
+    
+    AdcWindowPoolReset();
+    windowsReady = true;
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+        windowsReady = windowsReady && AdcWindowCreate(&slidingWindows[i], STATS_WINDOW_SAMPLES);
+    
+    if (!windowsReady)
+        UARTSendString(">>> Sliding windows: STATS_WINDOW_SAMPLES too large\r\n");
+}
+
+/**
+ * @brief Display the sliding-window view (last STATS_WINDOW_SAMPLES samples)
+ *
+ * Mean, deviation and extremes are O(1) to read, so the view is as fresh as
+ * the last sample.
+ */
+void DisplayWindows(void)
+{
+    uint16_t i;
+    AdcStats win;
+    
+    if (!windowsReady || (slidingWindows[0].count == 0U))
+        return;
+    
+    UARTSendString("Window (last ");
+    UARTSendUInt(slidingWindows[0].count);
+    UARTSendString(" samples):\r\n");
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        AdcWindowToVolts(&slidingWindows[i], AdcCalGetSlope(i), AdcCalGetIntercept(i), &win);
+        
+        UARTSendString(adcChannels[i].name);
+        UARTSendString(" | avg ");
+        UARTSendFloat(AdcStatsMean(&win));
+        UARTSendString(" V, std ");
+        UARTSendFloat(AdcStatsStdDev(&win) * 1000.0f);
+        UARTSendString(" mV, min ");
+        UARTSendFloat(win.min);
+        UARTSendString(" V, max ");
+        UARTSendFloat(win.max);
+        UARTSendString(" V\r\n");
+    }
+}
+
+/**
+ * @brief Allocate one code histogram per channel in GS RAM
+ *
+ * 12-bit channels bin every code; 16-bit channels bin HIST_WINDOW_BINS_16BIT
+ * codes centred on the start-up reading, one code per bin.
+ */
+void InitHistograms(void)
+{
+    uint16_t i;
+    
+    AdcHistogramPoolReset();
+    histogramsReady = true;
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        if (adcChannels[i].resolution == ADC_RESOLUTION_12BIT)
+        {
+            histogramsReady = histogramsReady &&
+                              AdcHistogramCreate(&codeHistograms[i], 4096U, 0U, 0U);
+        }
+        else
+        {
+            histogramsReady = histogramsReady &&
+                              AdcHistogramCreate(&codeHistograms[i], HIST_WINDOW_BINS_16BIT, 0U, 0U);
+            if (histogramsReady)
+                AdcHistogramCenter(&codeHistograms[i], adcRawData[i]);
+        }
+    }
+    
+    if (!histogramsReady)
+        UARTSendString(">>> Histograms: bin pools too small\r\n");
+}
+
+/**
+ * @brief Display the histogram summary: range, out-of-range and missing codes
+ */
+void DisplayHistograms(void)
+{
+    uint16_t i;
+    
+    if (!histogramsReady || (codeHistograms[0].total == 0U))
+        return;
+    
+    UARTSendString("Code histograms:\r\n");
+    for (i = 0; i < NUM_ADC_CHANNELS; i++)
+    {
+        const AdcHistogram *h = &codeHistograms[i];
+        uint32_t first = (uint32_t)h->base << h->shift;
+        
+        UARTSendString(adcChannels[i].name);
+        UARTSendString(" | n ");
+        UARTSendUInt(h->total);
+        UARTSendString(", codes ");
+        UARTSendUInt(first);
+        UARTSendString("..");
+        UARTSendUInt(first + ((uint32_t)h->numBins << h->shift) - 1U);
+        UARTSendString(", under ");
+        UARTSendUInt(h->under);
+        UARTSendString(", over ");
+        UARTSendUInt(h->over);
+        UARTSendString(", missing ");
+        UARTSendUInt(AdcHistogramMissingCodes(h));
+        UARTSendString(h->saturated ? " (SATURATED)\r\n" : "\r\n");
+    }
+}
+
+/**
+ * @brief Restart the stages that need a continuous stream after lost samples
+ *
+ * Goertzel blocks, the FFT record and the CIC, FIR and biquad states would
+ * otherwise splice the samples on both sides of the gap. The biquads are
+ * primed with the latest sample, so they restart without a step.
+ */
+void ResetStreamStages(void)
+{
+    uint16_t ch;
+    
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        if (tonesReady)
+            AdcGoertzelClear(&toneBanks[ch]);
+        if (decimatorsReady)
+            AdcDecimatorReset(&decimators[ch]);
+        if (firReady)
+            AdcFirReset(&firFilters[ch]);
+        if (biquadsReady)
+            AdcBiquadPrime(&biquads[ch], (float)adcRawData[ch]);
+    }
+    if (spectrumReady)
+        AdcSpectrumClear();
+}
+
+/**
+ * @brief Send one raw byte via UART (binary export sink)
+ */
+void UARTSendByte(uint16_t byte)
+{
+    UartTxWrite(byte & 0xFFU);
+}
+
+/**
+ * @brief Reset the quantile estimators of every channel
+ */
+void InitQuantiles(void)
+{
+    uint16_t ch;
+    uint16_t k;
+    
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        for (k = 0; k < NUM_QUANTILES; k++)
+            AdcQuantileInit(&channelQuantiles[ch][k], quantileProbs[k]);
+    }
+}
+
+/**
+ * @brief Feed the latest raw sample into the quantile estimators
+ *
+ * Codes are estimated directly and converted to volts at display time.
+ */
+void UpdateQuantiles(void)
+{
+    uint16_t ch;
+    uint16_t k;
+    
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        for (k = 0; k < NUM_QUANTILES; k++)
+            AdcQuantileUpdate(&channelQuantiles[ch][k], (float)adcRawData[ch]);
+    }
+}
+
+/**
+ * @brief Display the quantiles since start-up, in volts
+ */
+void DisplayQuantiles(void)
+{
+    uint16_t ch;
+    uint16_t k;
+    
+    if (channelQuantiles[0][0].count == 0U)
+        return;
+    
+    UARTSendString("Quantiles since start-up (V): p50 | p95 | p99 | p99.9\r\n");
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        float slope = AdcCalGetSlope(ch);
+        float intercept = AdcCalGetIntercept(ch);
+        
+        UARTSendString(adcChannels[ch].name);
+        for (k = 0; k < NUM_QUANTILES; k++)
+        {
+            UARTSendString(" | ");
+            UARTSendFloat(AdcQuantileValue(&channelQuantiles[ch][k]) * slope + intercept);
+        }
+        UARTSendString("\r\n");
+    }
+}
+
+/**
+ * @brief Analyze the FFT record as soon as it is full (from the sample path)
+ *
+ * Runs once per record, not in the report, so the UART output never waits
+ * for the FFT. Capture stays paused until DisplaySpectrum() shows the result.
+ */
+void AnalyzeSpectrum(void)
+{
+    uint16_t ch = spectrumChannel;
+    float fullScale;
+    
+    fullScale = (adcChannels[ch].resolution == ADC_RESOLUTION_16BIT) ? 65536.0f : 4096.0f;
+    spectrumFresh = AdcSpectrumAnalyze(fullScale, (float)acqSampleRate, &spectrumResult);
+}
+
+/**
+ * @brief Display the metrics of the last analyzed FFT record
+ *
+ * Records alternate between channels; a channel's metrics are shown at the
+ * first report after its record has been analyzed.
+ */
+void DisplaySpectrum(void)
+{
+    uint16_t ch = spectrumChannel;
+    
+    if (!spectrumReady || !spectrumFresh)
+        return;
+    
+    // Next record from the other channel
+    spectrumChannel = (ch + 1U) % NUM_ADC_CHANNELS;
+    spectrumFresh = false;
+    
+    UARTSendString("Spectrum ");
+    UARTSendString(adcChannels[ch].name);
+    UARTSendString(" (");
+    UARTSendUInt(spectrumResult.points);
+    UARTSendString(" pts): f ");
+    UARTSendFloat(spectrumResult.fundamentalHz);
+    UARTSendString(" Hz, ");
+    UARTSendFloat(spectrumResult.signalDbfs);
+    UARTSendString(" dBFS\r\n");
+    UARTSendString("  SNR ");
+    UARTSendFloat(spectrumResult.snrDb);
+    UARTSendString(" dB, SINAD ");
+    UARTSendFloat(spectrumResult.sinadDb);
+    UARTSendString(" dB, THD ");
+    UARTSendFloat(spectrumResult.thdDb);
+    UARTSendString(" dBc, SFDR ");
+    UARTSendFloat(spectrumResult.sfdrDb);
+    UARTSendString(" dBc, ENOB ");
+    UARTSendFloat(spectrumResult.enob);
+    UARTSendString("\r\n");
+}
+
+/**
+ * @brief Set up the Goertzel banks once the sample rate is known
+ */
+void InitTones(uint32_t sampleRateHz)
+{
+    uint16_t ch;
+    
+    tonesReady = true;
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        tonesReady = tonesReady &&
+                     AdcGoertzelInit(&toneBanks[ch], toneFrequencies, NUM_TONES,
+                                     (float)sampleRateHz, sampleRateHz / TONE_BLOCKS_PER_SECOND);
+    }
+    
+    if (!tonesReady)
+        UARTSendString(">>> Tone tracking: tone list or block length out of range\r\n");
+}
+
+/**
+ * @brief Display amplitude and phase of the tracked tones (last block)
+ */
+void DisplayTones(void)
+{
+    uint16_t ch;
+    uint16_t k;
+    
+    if (!tonesReady || (toneBanks[0].blocks == 0U))
+        return;
+    
+    UARTSendString("Tones (block of ");
+    UARTSendUInt(toneBanks[0].blockLength);
+    UARTSendString(" samples, ");
+    UARTSendUInt(toneBanks[0].blocks);
+    UARTSendString(" blocks): amplitude mV / phase deg\r\n");
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        float slope = fabsf(AdcCalGetSlope(ch));
+        
+        UARTSendString(adcChannels[ch].name);
+        for (k = 0; k < NUM_TONES; k++)
+        {
+            const AdcGoertzelResult *r = &toneBanks[ch].result[k];
+            
+            UARTSendString(" | ");
+            UARTSendUInt((uint32_t)r->frequencyHz);
+            UARTSendString(" Hz ");
+            UARTSendFloat(r->amplitude * slope * 1000.0f);
+            UARTSendString(" / ");
+            UARTSendFloat(r->phaseDeg);
+        }
+        UARTSendString("\r\n");
+    }
+}
+
+/**
+ * @brief Set up one decimator per channel (ratios in decimationRatios[])
+ */
+void InitDecimators(void)
+{
+    uint16_t ch;
+    
+    decimatorsReady = true;
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        uint16_t bits = (adcChannels[ch].resolution == ADC_RESOLUTION_16BIT) ? 16U : 12U;
+        
+        decimatorsReady = decimatorsReady &&
+                          AdcDecimatorInit(&decimators[ch], decimationRatios[ch], bits);
+        AdcStatsReset(&decimatedStats[ch]);
+        decimatedLast[ch] = 0.0f;
+    }
+    
+    if (!decimatorsReady)
+        UARTSendString(">>> Decimation: ratio out of range\r\n");
+}
+
+/**
+ * @brief Decimate codes of one channel and feed the low-rate stream
+ *
+ * The input is cut so that no call produces more than DECIM_OUT_SAMPLES
+ * outputs; each output costs one float conversion at the low rate.
+ */
+void DecimateCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride)
+{
+    const uint16_t chunk = (DECIM_OUT_SAMPLES - 1U) * ADC_DECIM_MIN_RATIO;
+    float slope = AdcCalGetSlope(ch) / (float)(1U << ADC_DECIM_FRAC_BITS);
+    float intercept = AdcCalGetIntercept(ch);
+    
+    while (n > 0U)
+    {
+        uint16_t len = (n > chunk) ? chunk : n;
+        size_t count = AdcDecimatorProcess(&decimators[ch], in, len, stride,
+                                           decimatedCodes, DECIM_OUT_SAMPLES);
+        size_t k;
+        
+        for (k = 0; k < count; k++)
+        {
+            decimatedLast[ch] = (float)decimatedCodes[k] * slope + intercept;
+            AdcStatsUpdate(&decimatedStats[ch], decimatedLast[ch]);
+        }
+        
+        in += (uint32_t)len * stride;
+        n -= len;
+    }
+}
+
+/**
+ * @brief Display the decimated streams (batch statistics and latest value)
+ */
+void DisplayDecimated(void)
+{
+    uint16_t ch;
+    
+    if (!decimatorsReady || (decimatedStats[0].count == 0U))
+        return;
+    
+    UARTSendString("Decimated streams (CIC + FIR, Q8 codes):\r\n");
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        UARTSendString(adcChannels[ch].name);
+        UARTSendString(" | R ");
+        UARTSendUInt(decimators[ch].ratio);
+        UARTSendString(", ");
+        UARTSendUInt(acqSampleRate / decimators[ch].ratio);
+        UARTSendString(" Hz, n ");
+        UARTSendUInt(decimatedStats[ch].count);
+        UARTSendString(", last ");
+        UARTSendFloat(decimatedLast[ch]);
+        UARTSendString(" V, std ");
+        UARTSendFloat(AdcStatsStdDev(&decimatedStats[ch]) * 1000.0f);
+        UARTSendString(" mV\r\n");
+    }
+}
+
+/**
+ * @brief Set up one low-pass decimating FIR filter per channel
+ *
+ * Windowed-sinc prototype (FIR_TAPS, FIR_CUTOFF), unity DC gain, output rate
+ * fs / FIR_DECIMATION.
+ */
+void InitFilters(void)
+{
+    uint16_t ch;
+    
+    AdcFirPoolReset();
+    AdcFirDesignLowpass(firPrototype, FIR_TAPS, FIR_CUTOFF, 1.0f);
+    
+    firReady = true;
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        firReady = firReady &&
+                   AdcFirCreate(&firFilters[ch], firPrototype, FIR_TAPS, FIR_DECIMATION, 1U);
+        AdcStatsReset(&firStats[ch]);
+        firLast[ch] = 0.0f;
+    }
+    
+    if (!firReady)
+        UARTSendString(">>> FIR: filters do not fit in the pools\r\n");
+}
+
+/**
+ * @brief Filter codes of one channel and feed the filtered stream
+ *
+ * The input is cut so that no call produces more than FIR_OUT_SAMPLES
+ * outputs.
+ */
+void FilterCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride)
+{
+    const uint16_t chunk = (FIR_OUT_SAMPLES - 1U) * FIR_DECIMATION;
+    float slope = AdcCalGetSlope(ch);
+    float intercept = AdcCalGetIntercept(ch);
+    
+    while (n > 0U)
+    {
+        uint16_t len = (n > chunk) ? chunk : n;
+        size_t count = AdcFirProcessCodes(&firFilters[ch], in, len, stride, firOutput);
+        size_t k;
+        
+        for (k = 0; k < count; k++)
+        {
+            firLast[ch] = firOutput[k] * slope + intercept;
+            AdcStatsUpdate(&firStats[ch], firLast[ch]);
+        }
+        
+        in += (uint32_t)len * stride;
+        n -= len;
+    }
+}
+
+/**
+ * @brief Display the FIR-filtered streams (batch statistics and latest value)
+ */
+void DisplayFilters(void)
+{
+    uint16_t ch;
+    
+    if (!firReady || (firStats[0].count == 0U))
+        return;
+    
+    UARTSendString("FIR low-pass (");
+    UARTSendUInt(FIR_TAPS);
+    UARTSendString(" taps, D ");
+    UARTSendUInt(FIR_DECIMATION);
+    UARTSendString("):\r\n");
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        UARTSendString(adcChannels[ch].name);
+        UARTSendString(" | n ");
+        UARTSendUInt(firStats[ch].count);
+        UARTSendString(", last ");
+        UARTSendFloat(firLast[ch]);
+        UARTSendString(" V, std ");
+        UARTSendFloat(AdcStatsStdDev(&firStats[ch]) * 1000.0f);
+        UARTSendString(" mV\r\n");
+    }
+}
+
+/**
+ * @brief Design the biquad coefficient sets for the sample rate and set up
+ * one cascade per channel (set chosen by biquadChannelSet[])
+ *
+ * The cascades are primed with the start-up reading, so the first report
+ * has no start-up step.
+ */
+void InitBiquads(uint32_t sampleRateHz)
+{
+    float fs = (float)sampleRateHz;
+    uint16_t ch;
+    
+    AdcBiquadDesignNotch(&biquadSets[BIQUAD_SET_HUM][0], 50.0f, fs, BIQUAD_NOTCH_Q);
+    AdcBiquadDesignNotch(&biquadSets[BIQUAD_SET_HUM][1], 60.0f, fs, BIQUAD_NOTCH_Q);
+    AdcBiquadDesignLowpass(&biquadSets[BIQUAD_SET_LOWPASS][0], BIQUAD_LOWPASS_HZ, fs, 0.5412f);
+    AdcBiquadDesignLowpass(&biquadSets[BIQUAD_SET_LOWPASS][1], BIQUAD_LOWPASS_HZ, fs, 1.3066f);
+    
+    biquadsReady = (2.0f * BIQUAD_LOWPASS_HZ < fs) && (2.0f * 60.0f < fs);
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        if (biquadChannelSet[ch] >= NUM_BIQUAD_SETS)
+            biquadChannelSet[ch] = BIQUAD_SET_HUM;
+        biquadsReady = biquadsReady &&
+                       AdcBiquadInit(&biquads[ch], biquadSets[biquadChannelSet[ch]],
+                                     BIQUAD_SECTIONS);
+        if (biquadsReady)
+            AdcBiquadPrime(&biquads[ch], (float)adcRawData[ch]);
+        AdcStatsReset(&biquadStats[ch]);
+        biquadLast[ch] = 0.0f;
+    }
+    
+    if (!biquadsReady)
+        UARTSendString(">>> IIR: sample rate too low for the biquad sets\r\n");
+}
+
+/**
+ * @brief Filter codes of one channel through its biquad cascade
+ *
+ * A new value in biquadChannelSet[] (e.g. written from the debugger) is
+ * applied here without clearing the filter state.
+ */
+void BiquadCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride)
+{
+    float slope = AdcCalGetSlope(ch);
+    float intercept = AdcCalGetIntercept(ch);
+    uint16_t set = biquadChannelSet[ch];
+    
+    if ((set < NUM_BIQUAD_SETS) && (biquads[ch].coeff != biquadSets[set]))
+        AdcBiquadSelect(&biquads[ch], biquadSets[set], BIQUAD_SECTIONS);
+    
+    if (n == 1U)
+    {
+        biquadLast[ch] = AdcBiquadStep(&biquads[ch], (float)in[0]) * slope + intercept;
+        AdcStatsUpdate(&biquadStats[ch], biquadLast[ch]);
+        return;
+    }
+    
+    while (n > 0U)
+    {
+        uint16_t len = (n > BLOCK_CHUNK_SAMPLES) ? BLOCK_CHUNK_SAMPLES : n;
+        uint16_t k;
+        
+        AdcBiquadProcessCodes(&biquads[ch], in, len, stride, biquadOutput);
+        for (k = 0; k < len; k++)
+            biquadOutput[k] = biquadOutput[k] * slope + intercept;
+        AdcStatsUpdateBlock(&biquadStats[ch], biquadOutput, len);
+        biquadLast[ch] = biquadOutput[len - 1U];
+        
+        in += (uint32_t)len * stride;
+        n -= len;
+    }
+}
+
+/**
+ * @brief Display the IIR-filtered streams (batch statistics and latest value)
+ */
+void DisplayBiquads(void)
+{
+    uint16_t ch;
+    
+    if (!biquadsReady || (biquadStats[0].count == 0U))
+        return;
+    
+    UARTSendString("IIR biquads (");
+    UARTSendUInt(BIQUAD_SECTIONS);
+    UARTSendString(" sections):\r\n");
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        UARTSendString(adcChannels[ch].name);
+        UARTSendString((biquadChannelSet[ch] == BIQUAD_SET_LOWPASS) ? " | low-pass" :
+                                                                    " | 50/60 Hz notch");
+        UARTSendString(", n ");
+        UARTSendUInt(biquadStats[ch].count);
+        UARTSendString(", last ");
+        UARTSendFloat(biquadLast[ch]);
+        UARTSendString(" V, std ");
+        UARTSendFloat(AdcStatsStdDev(&biquadStats[ch]) * 1000.0f);
+        UARTSendString(" mV\r\n");
+    }
+}
+
+/**
+ * @brief Set up the moving average and EMA of every channel
+ * (smoothLog2Length[], smoothEmaShift[])
+ */
+void InitSmoothing(void)
+{
+    uint16_t ch;
+    
+    AdcSmoothPoolReset();
+    
+    smoothingReady = true;
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        smoothingReady = smoothingReady &&
+                         AdcMovingAverageCreate(&movingAverages[ch], smoothLog2Length[ch]) &&
+                         AdcEmaInit(&emaFilters[ch], smoothEmaShift[ch]);
+    }
+    
+    if (!smoothingReady)
+        UARTSendString(">>> Smoothing: length or shift out of range\r\n");
+}
+
+/**
+ * @brief Read the smoothed values of one channel in volts
+ *
+ * Constant time: the pipeline keeps the sums current, so only the
+ * calibration is applied here.
+ */
+void GetSmoothedVolts(uint16_t ch, float *maVolts, float *emaVolts)
+{
+    float slope = AdcCalGetSlope(ch);
+    float intercept = AdcCalGetIntercept(ch);
+    
+    *maVolts = AdcMovingAverageValue(&movingAverages[ch]) * slope + intercept;
+    *emaVolts = AdcEmaValue(&emaFilters[ch]) * slope + intercept;
+}
+
+/**
+ * @brief Set up the spike filter of every channel (DESPIKE_WIDTH, DESPIKE_MODE)
+ */
+void InitDespike(void)
+{
+    uint16_t ch;
+    
+    despikeReady = true;
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        despikeReady = despikeReady &&
+                       AdcMedianInit(&despikeFilters[ch], DESPIKE_WIDTH, DESPIKE_MODE,
+                                     DESPIKE_THRESHOLD);
+        AdcStatsReset(&despikedStats[ch]);
+    }
+    
+    if (!despikeReady)
+        UARTSendString(">>> Despike: DESPIKE_WIDTH must be odd, 3 to 31\r\n");
+}
+
+/**
+ * @brief Filter codes of one channel and feed the spike-filtered stream
+ */
+void DespikeCodes(uint16_t ch, const uint16_t *in, uint16_t n, uint16_t stride)
+{
+    float slope = AdcCalGetSlope(ch);
+    float intercept = AdcCalGetIntercept(ch);
+    
+    if (n == 1U)
+    {
+        uint16_t code = AdcMedianUpdate(&despikeFilters[ch], in[0]);
+        AdcStatsUpdate(&despikedStats[ch], (float)code * slope + intercept);
+        return;
+    }
+    
+    while (n > 0U)
+    {
+        uint16_t len = (n > BLOCK_CHUNK_SAMPLES) ? BLOCK_CHUNK_SAMPLES : n;
+        uint16_t k;
+        
+        AdcMedianUpdateBlock(&despikeFilters[ch], in, len, stride, despikedCodes);
+        for (k = 0; k < len; k++)
+            AdcStatsUpdate(&despikedStats[ch], (float)despikedCodes[k] * slope + intercept);
+        
+        in += (uint32_t)len * stride;
+        n -= len;
+    }
+}
+
+/**
+ * @brief Display the spike-filtered statistics in the columns of the main table
+ */
+void DisplayDespiked(void)
+{
+    uint16_t ch;
+    
+    if (!despikeReady || (despikedStats[0].count == 0U))
+        return;
+    
+    UARTSendString((DESPIKE_MODE == ADC_MEDIAN_MODE_HAMPEL) ? "Hampel W " : "Median W ");
+    UARTSendUInt(DESPIKE_WIDTH);
+    UARTSendString(":\r\n");
+    for (ch = 0; ch < NUM_ADC_CHANNELS; ch++)
+    {
+        const AdcStats *st = &despikedStats[ch];
+        
+        UARTSendString(adcChannels[ch].name);
+        UARTSendString(" | ");
+        UARTSendFloat(st->min);
+        UARTSendString(" | ");
+        UARTSendFloat(st->max);
+        UARTSendString(" | ");
+        UARTSendFloat(AdcStatsMean(st));
+        UARTSendString(" | ");
+        UARTSendFloat(AdcStatsStdDev(st) * 1000.0f);
+        UARTSendString(" | ");
+        UARTSendFloat(AdcStatsPeakToPeak(st) * 1000.0f);
+        if (DESPIKE_MODE == ADC_MEDIAN_MODE_HAMPEL)
+        {
+            UARTSendString(" | replaced ");
+            UARTSendUInt(despikeFilters[ch].replaced);
+        }
+        UARTSendString("\r\n");
+    }
+}